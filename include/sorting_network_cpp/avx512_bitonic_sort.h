@@ -0,0 +1,235 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+#include <sorting_network_cpp/vector_sorting_network.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// The kernel is compiled with the target attribute of GCC and Clang, so that it
+// is available without -mavx512f; it must only be called on CPUs supporting
+// AVX-512F (see detected_isa() in dispatched_sorting_network.h)
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS) && (defined(__x86_64__) || defined(__i386__))
+#define SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT
+#endif
+
+#if defined(SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT)
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace quxflux::sorting_net
+{
+  // true if avx512_bitonic_sort<N> can sort values of type T
+  template<typename T, std::size_t N>
+  static inline constexpr bool avx512_bitonic_sort_available_v =
+    vector_available_v<T> && sizeof(T) == 4 && N > 0 && N <= 256;
+
+  namespace detail
+  {
+    // Executes the layers of a network on values which are distributed over
+    // Registers vectors of Lanes values (value i is stored in lane i % Lanes of
+    // register i / Lanes). Per layer and register the counterparts of all lanes
+    // are gathered from the register itself and at most one other register
+    // with a single two source shuffle.
+    template<typename Network, std::size_t Lanes, std::size_t Registers>
+    struct register_network
+    {
+    private:
+      using flattened = flattened_network<Network>;
+
+      struct register_layer
+      {
+        // register holding the counterparts of the lanes which are not
+        // compared with a lane of the same register
+        std::array<std::size_t, Registers> other_register{};
+
+        // per lane index of the counterpart in the concatenation of the
+        // register and other_register
+        std::array<std::array<int, Lanes>, Registers> permutation{};
+        std::array<std::array<bool, Lanes>, Registers> takes_min{};
+      };
+
+      static constexpr std::array<register_layer, flattened::depth> make_layers()
+      {
+        std::array<register_layer, flattened::depth> result{};
+
+        for (auto& layer : result)
+        {
+          for (std::size_t r = 0; r < Registers; ++r)
+          {
+            layer.other_register[r] = r;
+
+            for (std::size_t l = 0; l < Lanes; ++l)
+              layer.permutation[r][l] = static_cast<int>(l);
+          }
+        }
+
+        const auto connect = [&](register_layer& layer, const std::size_t from, const std::size_t to) {
+          const std::size_t r = from / Lanes;
+          const std::size_t l = from % Lanes;
+
+          if (to / Lanes == r)
+          {
+            layer.permutation[r][l] = static_cast<int>(to % Lanes);
+          } else
+          {
+            // a register may only exchange values with a single other register
+            // per layer; conflicts are marked with an invalid register index
+            const bool conflict = layer.other_register[r] != r && layer.other_register[r] != to / Lanes;
+
+            layer.other_register[r] = conflict ? Registers : to / Lanes;
+            layer.permutation[r][l] = static_cast<int>(Lanes + to % Lanes);
+          }
+        };
+
+        for (std::size_t i = 0; i < flattened::comparators.size(); ++i)
+        {
+          const auto [a, b] = flattened::comparators[i];
+          auto& layer = result[flattened::layers[i]];
+
+          connect(layer, a, b);
+          connect(layer, b, a);
+          layer.takes_min[a / Lanes][a % Lanes] = true;
+        }
+
+        return result;
+      }
+
+      static constexpr std::array<register_layer, flattened::depth> layers = make_layers();
+
+      static constexpr bool is_valid()
+      {
+        for (const auto& layer : layers)
+          for (const std::size_t other_register : layer.other_register)
+            if (other_register == Registers)
+              return false;
+
+        return true;
+      }
+
+      static_assert(is_valid(), "the counterparts of a register are distributed over more than two registers");
+
+      template<std::size_t L, std::size_t R, typename V, std::size_t... Is>
+      static V apply_register(const std::array<V, Registers>& v, std::index_sequence<Is...>) noexcept
+      {
+        using mask_t = decltype(v[R] < v[R]);
+
+        constexpr const register_layer& layer = layers[L];
+
+        const V partner =
+          __builtin_shufflevector(v[R], v[layer.other_register[R]], layer.permutation[R][Is]...);
+        const mask_t takes_min{(layer.takes_min[R][Is] ? -1 : 0)...};
+
+        const auto less = v[R] < partner;
+        const V min = less ? v[R] : partner;
+        const V max = less ? partner : v[R];
+
+        return takes_min ? min : max;
+      }
+
+      template<std::size_t L, typename V, std::size_t... Rs>
+      static std::array<V, Registers> apply_layer(const std::array<V, Registers>& v,
+                                                  std::index_sequence<Rs...>) noexcept
+      {
+        return {apply_register<L, Rs>(v, std::make_index_sequence<Lanes>{})...};
+      }
+
+      template<typename V, std::size_t... Ls>
+      static void apply_layers(std::array<V, Registers>& v, std::index_sequence<Ls...>) noexcept
+      {
+        ((v = apply_layer<Ls>(v, std::make_index_sequence<Registers>{})), ...);
+      }
+
+    public:
+      template<typename V>
+      static void apply(std::array<V, Registers>& v) noexcept
+      {
+        apply_layers(v, std::make_index_sequence<flattened::depth>{});
+      }
+    };
+  }  // namespace detail
+
+  // Sorts up to 256 values of a 32 bit type (e.g. std::int32_t, std::uint32_t
+  // or float) in ascending order without touching memory between the layers:
+  // the values are loaded into up to 16 AVX-512 registers (padded with the
+  // maximum value of T to the next power of two using masked loads) and sorted
+  // with the bitonic merge sort network of this size. The permutations of each
+  // layer are derived from the network generated for type::bitonic_merge_sort.
+  template<std::size_t N>
+  struct avx512_bitonic_sort
+  {
+    static constexpr std::size_t lanes = 16;
+    static constexpr std::size_t size = detail::next_power_of_two(N < lanes ? lanes : N);
+    static constexpr std::size_t registers = size / lanes;
+
+    template<typename T>
+    __attribute__((target("avx512f"), flatten)) void operator()(T* const begin) const noexcept
+    {
+      static_assert(avx512_bitonic_sort_available_v<T, N>);
+
+      using network = typename detail::sorting_network<size, type::bitonic_merge_sort>::type;
+      using vector = vector_t<T, lanes>;
+
+      constexpr T sentinel = std::numeric_limits<T>::max();
+
+      std::int32_t sentinel_bits;
+      std::memcpy(&sentinel_bits, &sentinel, sizeof(T));
+
+      const __m512i padding = _mm512_set1_epi32(sentinel_bits);
+
+      std::array<vector, registers> v;
+
+      for (std::size_t r = 0; r < registers; ++r)
+      {
+        const __mmask16 mask = load_mask(r);
+        v[r] = reinterpret_cast<vector>(_mm512_mask_loadu_epi32(padding, mask, begin + r * lanes));
+      }
+
+      detail::register_network<network, lanes, registers>::apply(v);
+
+      for (std::size_t r = 0; r < registers; ++r)
+        _mm512_mask_storeu_epi32(begin + r * lanes, load_mask(r), reinterpret_cast<__m512i>(v[r]));
+    }
+
+  private:
+    // lanes of register r which hold one of the N values
+    static constexpr std::uint16_t load_mask(const std::size_t r) noexcept
+    {
+      if (r * lanes >= N)
+        return 0;
+
+      return N - r * lanes >= lanes ? 0xffff : static_cast<std::uint16_t>((1u << (N - r * lanes)) - 1u);
+    }
+  };
+}  // namespace quxflux::sorting_net
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+namespace quxflux::sorting_net
+{
+  template<typename T, typename Predicate, typename Stats>
+  struct counting_compare_and_swap;
+
+  // Statistics about the compare and swap operations executed by
+  // sorting_network<N, NetworkType>, collected by counting_compare_and_swap.
+  // Comparators are identified by their position in the network (in order of
+  // execution); layers are formed by scheduling every comparator as early as
+  // possible.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  struct compare_and_swap_stats
+  {
+  private:
+    using network = detail::flattened_network<typename detail::sorting_network<N, NetworkType>::type>;
+
+    template<typename T, typename Predicate, typename Stats>
+    friend struct counting_compare_and_swap;
+
+    // position of the comparator which is executed next
+    std::size_t next_comparator_ = 0;
+
+  public:
+    static constexpr std::size_t num_comparators = network::comparators.size();
+    static constexpr std::size_t depth = network::depth;
+
+    // the comparators of the network and the layer each one belongs to
+    static constexpr const std::array<detail::comparator, num_comparators>& comparators = network::comparators;
+    static constexpr const std::array<std::size_t, num_comparators>& layers = network::layers;
+
+    // number of executed compare and swap operations
+    std::size_t comparisons = 0;
+
+    // number of compare and swap operations which actually exchanged the two
+    // values, in total, per comparator and per layer
+    std::size_t swaps = 0;
+    std::array<std::size_t, num_comparators> swaps_per_comparator{};
+    std::array<std::size_t, depth> swaps_per_layer{};
+
+    // number of completely executed sorts
+    constexpr std::size_t num_sorts() const noexcept { return num_comparators > 0 ? comparisons / num_comparators : 0; }
+  };
+
+  // Tag type which disables the collection of statistics;
+  // counting_compare_and_swap<T, Predicate, disabled_stats> is equivalent to
+  // compare_and_swap<T, Predicate>
+  struct disabled_stats
+  {};
+
+  // Compare and swap operation which records the executed comparisons and
+  // exchanges in a caller provided compare_and_swap_stats object. The stats
+  // object has to match the sorting network the operation is used with.
+  template<typename T, typename Predicate = std::less<T>, typename Stats = disabled_stats>
+  struct counting_compare_and_swap
+  {
+    constexpr explicit counting_compare_and_swap(Stats& stats) noexcept : stats_(&stats) {}
+
+    constexpr void operator()(T& a, T& b) const noexcept
+    {
+      const std::size_t i = stats_->next_comparator_;
+      stats_->next_comparator_ = (i + 1_z == Stats::num_comparators) ? 0_z : i + 1_z;
+
+      ++stats_->comparisons;
+
+      if (Predicate{}(b, a))
+      {
+        ++stats_->swaps;
+        ++stats_->swaps_per_comparator[i];
+        ++stats_->swaps_per_layer[Stats::layers[i]];
+      }
+
+      compare_and_swap<T, Predicate>{}(a, b);
+    }
+
+  private:
+    Stats* stats_;
+  };
+
+  template<typename T, typename Predicate>
+  struct counting_compare_and_swap<T, Predicate, disabled_stats> : compare_and_swap<T, Predicate>
+  {
+    constexpr counting_compare_and_swap() noexcept = default;
+    constexpr explicit counting_compare_and_swap(disabled_stats&) noexcept {}
+  };
+}  // namespace quxflux::sorting_net
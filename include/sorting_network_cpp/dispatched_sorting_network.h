@@ -0,0 +1,276 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/avx512_bitonic_sort.h>
+#include <sorting_network_cpp/sorting_network.h>
+#include <sorting_network_cpp/vector_sorting_network.h>
+
+#include <array>
+#include <cstdlib>
+#include <string_view>
+
+// Kernels for several x86 instruction sets are compiled into the same binary
+// with the target attribute of GCC and Clang; on other platforms and compilers
+// only the scalar kernel is available
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SORTING_NETWORK_CPP_HAS_ISA_DISPATCH
+#endif
+
+namespace quxflux::sorting_net
+{
+  // Instruction set levels for which kernels are compiled, ordered by capability
+  enum class isa
+  {
+    scalar,
+    sse4_1,
+    avx2,
+    avx512
+  };
+
+  // Parses the names accepted by the environment variable SORTING_NETWORK_CPP_ISA
+  // ("scalar", "sse4.1", "avx2" and "avx512"); returns false for unknown names
+  constexpr bool parse_isa(const std::string_view name, isa& result) noexcept
+  {
+    constexpr std::array<std::pair<std::string_view, isa>, 4> names{
+      std::pair{std::string_view{"scalar"}, isa::scalar}, std::pair{std::string_view{"sse4.1"}, isa::sse4_1},
+      std::pair{std::string_view{"avx2"}, isa::avx2}, std::pair{std::string_view{"avx512"}, isa::avx512}};
+
+    for (const auto& [n, level] : names)
+    {
+      if (n == name)
+      {
+        result = level;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // The most capable instruction set level supported by the CPU
+  inline isa detected_isa() noexcept
+  {
+#if defined(SORTING_NETWORK_CPP_HAS_ISA_DISPATCH)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+      return isa::avx512;
+    if (__builtin_cpu_supports("avx2"))
+      return isa::avx2;
+    if (__builtin_cpu_supports("sse4.1"))
+      return isa::sse4_1;
+#endif
+
+    return isa::scalar;
+  }
+
+  // The instruction set level whose kernels are used by dispatched_sorting_network;
+  // resolved once on first use. Defaults to detected_isa() and can be lowered
+  // by setting the environment variable SORTING_NETWORK_CPP_ISA (levels not
+  // supported by the CPU are never selected).
+  inline isa selected_isa() noexcept
+  {
+    static const isa selected = [] {
+      const isa detected = detected_isa();
+      isa forced = detected;
+
+      if (const char* name = std::getenv("SORTING_NETWORK_CPP_ISA"); name && parse_isa(name, forced))
+        return forced < detected ? forced : detected;
+
+      return detected;
+    }();
+
+    return selected;
+  }
+
+  namespace detail
+  {
+    // Sorts num_arrays consecutive arrays of N values; groups of Lanes arrays are
+    // transposed into N vectors and sorted at once with vector_compare_and_swap
+    template<std::size_t N, type NetworkType, std::size_t Lanes, typename T>
+    inline void sort_arrays(T* const begin, const std::size_t num_arrays) noexcept
+    {
+      std::size_t i = 0;
+
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+      if constexpr (Lanes > 1 && vector_available_v<T>)
+      {
+        for (; i + Lanes <= num_arrays; i += Lanes)
+        {
+          T* const arrays = begin + i * N;
+          std::array<vector_t<T, Lanes>, N> vectors;
+
+          for (std::size_t j = 0; j < N; ++j)
+            for (std::size_t l = 0; l < Lanes; ++l)
+              vectors[j][l] = arrays[l * N + j];
+
+          sorting_net::sorting_network<N, NetworkType>{}(vectors.begin(), vector_compare_and_swap<T, Lanes>{});
+
+          for (std::size_t j = 0; j < N; ++j)
+            for (std::size_t l = 0; l < Lanes; ++l)
+              arrays[l * N + j] = vectors[j][l];
+        }
+      }
+#endif
+
+      for (; i < num_arrays; ++i)
+        sorting_net::sorting_network<N, NetworkType>{}(begin + i * N);
+    }
+
+    // One kernel per instruction set level; flatten inlines the whole network
+    // into the kernel, so that it is compiled for the kernel's target
+    struct scalar_kernels
+    {
+      template<std::size_t N, type NetworkType, typename T>
+      static void sort(T* const begin) noexcept
+      {
+        sorting_net::sorting_network<N, NetworkType>{}(begin);
+      }
+
+      template<std::size_t N, type NetworkType, typename T>
+      static void sort_arrays(T* const begin, const std::size_t num_arrays) noexcept
+      {
+        detail::sort_arrays<N, NetworkType, 1>(begin, num_arrays);
+      }
+    };
+
+#if defined(SORTING_NETWORK_CPP_HAS_ISA_DISPATCH)
+    struct sse4_1_kernels
+    {
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("sse4.1"), flatten)) static void sort(T* const begin) noexcept
+      {
+        sorting_net::sorting_network<N, NetworkType>{}(begin);
+      }
+
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("sse4.1"), flatten)) static void sort_arrays(
+        T* const begin, const std::size_t num_arrays) noexcept
+      {
+        detail::sort_arrays<N, NetworkType, 16 / sizeof(T)>(begin, num_arrays);
+      }
+    };
+
+    struct avx2_kernels
+    {
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("avx2"), flatten)) static void sort(T* const begin) noexcept
+      {
+        sorting_net::sorting_network<N, NetworkType>{}(begin);
+      }
+
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("avx2"), flatten)) static void sort_arrays(
+        T* const begin, const std::size_t num_arrays) noexcept
+      {
+        detail::sort_arrays<N, NetworkType, 32 / sizeof(T)>(begin, num_arrays);
+      }
+    };
+
+    struct avx512_kernels
+    {
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("avx512f,avx512bw"), flatten)) static void sort(T* const begin) noexcept
+      {
+#if defined(SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT)
+        // from 16 values on, the bitonic network is executed in registers
+        if constexpr (NetworkType == type::bitonic_merge_sort && N >= 16 && avx512_bitonic_sort_available_v<T, N>)
+        {
+          avx512_bitonic_sort<N>{}(begin);
+          return;
+        }
+#endif
+
+        sorting_net::sorting_network<N, NetworkType>{}(begin);
+      }
+
+      template<std::size_t N, type NetworkType, typename T>
+      __attribute__((target("avx512f,avx512bw"), flatten)) static void sort_arrays(
+        T* const begin, const std::size_t num_arrays) noexcept
+      {
+        detail::sort_arrays<N, NetworkType, 64 / sizeof(T)>(begin, num_arrays);
+      }
+    };
+#endif
+
+    template<std::size_t N, type NetworkType, typename T>
+    struct dispatch_table
+    {
+      using sort_t = void (*)(T*);
+      using sort_arrays_t = void (*)(T*, std::size_t);
+
+      sort_t sort = nullptr;
+      sort_arrays_t sort_arrays = nullptr;
+
+      template<typename Kernels>
+      static constexpr dispatch_table make() noexcept
+      {
+        return {&Kernels::template sort<N, NetworkType, T>, &Kernels::template sort_arrays<N, NetworkType, T>};
+      }
+
+      static dispatch_table select() noexcept
+      {
+#if defined(SORTING_NETWORK_CPP_HAS_ISA_DISPATCH)
+        switch (selected_isa())
+        {
+          case isa::avx512:
+            return make<avx512_kernels>();
+          case isa::avx2:
+            return make<avx2_kernels>();
+          case isa::sse4_1:
+            return make<sse4_1_kernels>();
+          case isa::scalar:
+            break;
+        }
+#endif
+
+        return make<scalar_kernels>();
+      }
+    };
+  }  // namespace detail
+
+  // Sorting network whose kernels are compiled for several instruction set
+  // levels; the kernel matching selected_isa() is resolved on first use. The
+  // values are sorted in ascending order.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  struct dispatched_sorting_network
+  {
+    // Sorts the N values starting at begin
+    template<typename T>
+    void operator()(T* const begin) const noexcept
+    {
+      table<T>().sort(begin);
+    }
+
+    // Sorts num_arrays consecutive arrays of N values starting at begin; with a
+    // vector instruction set several arrays are sorted at once
+    template<typename T>
+    void operator()(T* const begin, const std::size_t num_arrays) const noexcept
+    {
+      table<T>().sort_arrays(begin, num_arrays);
+    }
+
+  private:
+    template<typename T>
+    static const detail::dispatch_table<N, NetworkType, T>& table() noexcept
+    {
+      static const auto table = detail::dispatch_table<N, NetworkType, T>::select();
+      return table;
+    }
+  };
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,124 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace quxflux::sorting_net
+{
+  namespace detail
+  {
+    template<typename Key, typename Index>
+    struct key_index_pair
+    {
+      Key key;
+      Index index;
+    };
+
+    template<typename Compare>
+    struct compare_keys
+    {
+      template<typename Pair>
+      constexpr bool operator()(const Pair& a, const Pair& b) const
+      {
+        return Compare{}(a.key, b.key);
+      }
+    };
+  }  // namespace detail
+
+  // Sorts N (large) records by a key: the network sorts compact (key, index)
+  // pairs built with the key extractor, afterwards the records are moved to
+  // their sorted positions in a single cycle following pass. Every record is
+  // moved at most once (plus once per cycle), instead of at every comparator.
+  // The key should be cheap to copy; Compare has to be default constructible
+  // like the predicate of compare_and_swap.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  struct indirect_sorting_network
+  {
+    static_assert(N > 0);
+
+    using index_type = detail::index_type_t<N>;
+
+    // Returns the indices of the records in sorted order, i.e. the record at
+    // begin[result[i]] belongs to position i
+    template<typename It, typename KeyExtractor, typename Compare = std::less<>,
+             typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    static constexpr std::array<index_type, N> sorted_indices(const It begin, const KeyExtractor& key,
+                                                              const Compare& = {})
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+      using key_type = std::decay_t<std::invoke_result_t<const KeyExtractor&, const value_type&>>;
+      using pair_type = detail::key_index_pair<key_type, index_type>;
+
+      std::array<pair_type, N> pairs{};
+
+      for (std::size_t i = 0; i < N; ++i)
+        pairs[i] = pair_type{std::invoke(key, begin[i]), static_cast<index_type>(i)};
+
+      sorting_network<N, NetworkType>{}(pairs.begin(), compare_and_swap<pair_type, detail::compare_keys<Compare>>{});
+
+      std::array<index_type, N> result{};
+
+      for (std::size_t i = 0; i < N; ++i)
+        result[i] = pairs[i].index;
+
+      return result;
+    }
+
+    // Moves the record at begin[indices[i]] to position i; indices is
+    // consumed (every entry is set to its own position)
+    template<typename It, typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    static constexpr void apply_permutation(const It begin, std::array<index_type, N>& indices)
+    {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        if (indices[i] == i)
+          continue;
+
+        auto tmp = std::move(begin[i]);
+        std::size_t j = i;
+
+        while (indices[j] != i)
+        {
+          const std::size_t k = indices[j];
+
+          begin[j] = std::move(begin[k]);
+          indices[j] = static_cast<index_type>(j);
+          j = k;
+        }
+
+        begin[j] = std::move(tmp);
+        indices[j] = static_cast<index_type>(j);
+      }
+    }
+
+    template<typename It, typename KeyExtractor, typename Compare = std::less<>,
+             typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const It begin, const KeyExtractor& key, const Compare& compare = {}) const
+    {
+      auto indices = sorted_indices(begin, key, compare);
+      apply_permutation(begin, indices);
+    }
+  };
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,92 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace quxflux::sorting_net
+{
+  namespace detail
+  {
+    // Generates a network which inserts the value at the last of the Size
+    // indices Offset, Offset + Stride, ... into the values at the other indices,
+    // which are already in order. This is Batcher's odd-even merge of a sorted
+    // sequence with a sequence of a single value: for an odd Size the value is
+    // part of the subsequence at the even positions, only this subsequence has
+    // to be merged recursively and a final layer of comparators between the
+    // odd positions and their successors interleaves it with the (unchanged)
+    // subsequence at the odd positions. For an even Size the last two values
+    // are ordered first, which moves the maximum of all values to its final
+    // position and leaves an odd number of values to insert into.
+    template<std::size_t Offset, std::size_t Stride, std::size_t Size, typename = void>
+    struct gen_insert
+    {
+      using type = layer<>;
+    };
+
+    template<std::size_t Offset, std::size_t Stride, std::size_t Size>
+    struct gen_insert<Offset, Stride, Size, std::enable_if_t<(Size >= 2_z && Size % 2_z == 0_z)>>
+    {
+      using type = layer<cas_node<Offset + (Size - 2_z) * Stride, Offset + (Size - 1_z) * Stride>,
+                         typename gen_insert<Offset, Stride, Size - 1_z>::type>;
+    };
+
+    template<std::size_t Offset, std::size_t Stride, std::size_t Size>
+    struct gen_insert<Offset, Stride, Size, std::enable_if_t<(Size >= 3_z && Size % 2_z == 1_z)>>
+    {
+      template<std::size_t... Indices>
+      static auto gen_cas(std::index_sequence<Indices...>)
+        -> layer<cas_node<Offset + (2_z * Indices + 1_z) * Stride, Offset + (2_z * Indices + 2_z) * Stride>...>
+      {
+        return {};
+      }
+
+      using type = layer<typename gen_insert<Offset, 2_z * Stride, (Size + 1_z) / 2_z>::type,
+                         decltype(gen_cas(std::make_index_sequence<(Size - 1_z) / 2_z>()))>;
+    };
+  }  // namespace detail
+
+  // Inserts a new value into a sorted array: the first N - 1 values at begin
+  // have to be in order, the value at begin + N - 1 is merged into them. The
+  // network has N - 1 comparators arranged in O(log N) layers, in contrast to
+  // the N - 1 dependent comparators of an insertion step and the O(N log^2 N)
+  // comparators of sorting all N values again. Useful to maintain small sorted
+  // buffers (e.g. the k smallest values seen so far) which receive one value at
+  // a time. The CompareAndSwap operation has to establish the same order the
+  // first N - 1 values are sorted in.
+  template<std::size_t N>
+  struct insert_network
+  {
+    static_assert(N > 0);
+
+    using network = net<typename detail::gen_insert<0_z, 1_z, N>::type>;
+
+    template<typename It,
+             typename CompareAndSwap = compare_and_swap<typename std::iterator_traits<It>::value_type,
+                                                        std::less<typename std::iterator_traits<It>::value_type>>,
+             typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const It begin, const CompareAndSwap& cas = {}) const noexcept
+    {
+      if constexpr (N > 1)
+        apply(begin, cas, network{});
+    }
+  };
+}  // namespace quxflux::sorting_net
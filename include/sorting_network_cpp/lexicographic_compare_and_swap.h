@@ -0,0 +1,153 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace quxflux::sorting_net
+{
+  // Key extractor returning the member Member of a record
+  template<auto Member>
+  struct member_key
+  {
+    template<typename T>
+    constexpr const auto& operator()(const T& value) const noexcept
+    {
+      return value.*Member;
+    }
+  };
+
+  namespace detail
+  {
+    // true if the keys of b precede the keys of a in lexicographic order; every
+    // key is compared exactly once and the results are combined with bit
+    // operations, so no branch depends on the values
+    template<typename KeysA, typename KeysB, std::size_t... Is>
+    constexpr bool lexicographic_greater(const KeysA& a, const KeysB& b, std::index_sequence<Is...>) noexcept
+    {
+      bool greater = false;
+      bool equal = true;
+
+      ((greater |= equal & (std::get<Is>(b) < std::get<Is>(a)), equal &= (std::get<Is>(a) == std::get<Is>(b))), ...);
+
+      return greater;
+    }
+
+    template<typename T>
+    constexpr void select_swap(const bool swap, T& a, T& b) noexcept
+    {
+      const T min = swap ? b : a;
+      b = swap ? a : b;
+      a = min;
+    }
+  }  // namespace detail
+
+  // Compare and swap operation for records of type T (array of structures)
+  // which are ordered lexicographically by the keys returned by
+  // KeyExtractors (the first one is the primary key). The keys are compared
+  // without branches and the records are swapped with a select.
+  template<typename T, typename... KeyExtractors>
+  struct lexicographic_compare_and_swap
+  {
+    static_assert(sizeof...(KeyExtractors) > 0);
+
+    constexpr void operator()(T& a, T& b) const noexcept
+    {
+      const bool swap = detail::lexicographic_greater(std::forward_as_tuple(KeyExtractors{}(a)...),
+                                                      std::forward_as_tuple(KeyExtractors{}(b)...),
+                                                      std::index_sequence_for<KeyExtractors...>{});
+
+      detail::select_swap(swap, a, b);
+    }
+  };
+
+  // Random access iterator over several sequences of the same length (structure
+  // of arrays); dereferencing yields a tuple of references to the elements at
+  // the same position of every sequence
+  template<typename... Its>
+  struct soa_iterator
+  {
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<typename std::iterator_traits<Its>::value_type...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::tuple<typename std::iterator_traits<Its>::reference...>;
+
+    std::tuple<Its...> its;
+
+    constexpr explicit soa_iterator(const Its... iterators) : its(iterators...) {}
+
+    constexpr reference operator*() const
+    {
+      return std::apply([](const auto... it) { return reference{*it...}; }, its);
+    }
+
+    constexpr reference operator[](const difference_type n) const { return *(*this + n); }
+
+    constexpr soa_iterator& operator+=(const difference_type n)
+    {
+      std::apply([n](auto&... it) { ((it += n), ...); }, its);
+      return *this;
+    }
+
+    constexpr soa_iterator& operator-=(const difference_type n) { return *this += -n; }
+    constexpr soa_iterator& operator++() { return *this += 1; }
+    constexpr soa_iterator& operator--() { return *this -= 1; }
+
+    constexpr soa_iterator operator+(const difference_type n) const
+    {
+      auto result = *this;
+      return result += n;
+    }
+
+    constexpr soa_iterator operator-(const difference_type n) const { return *this + -n; }
+
+    constexpr difference_type operator-(const soa_iterator& rhs) const
+    {
+      return std::get<0>(its) - std::get<0>(rhs.its);
+    }
+
+    constexpr bool operator==(const soa_iterator& rhs) const { return std::get<0>(its) == std::get<0>(rhs.its); }
+    constexpr bool operator!=(const soa_iterator& rhs) const { return !(*this == rhs); }
+    constexpr bool operator<(const soa_iterator& rhs) const { return std::get<0>(its) < std::get<0>(rhs.its); }
+  };
+
+  // Compare and swap operation for soa_iterator: the first NumKeys sequences
+  // hold the keys (the first one is the primary key) by which the positions
+  // are ordered lexicographically, all sequences are swapped accordingly
+  template<std::size_t NumKeys>
+  struct soa_lexicographic_compare_and_swap
+  {
+    template<typename... Refs>
+    constexpr void operator()(const std::tuple<Refs...> a, const std::tuple<Refs...> b) const noexcept
+    {
+      static_assert(NumKeys > 0 && NumKeys <= sizeof...(Refs));
+
+      const bool swap = detail::lexicographic_greater(a, b, std::make_index_sequence<NumKeys>{});
+
+      std::apply([&](auto&... a_columns) {
+        std::apply([&](auto&... b_columns) { (detail::select_swap(swap, a_columns, b_columns), ...); }, b);
+      }, a);
+    }
+  };
+}  // namespace quxflux::sorting_net
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <sorting_network_cpp/networks/auto_select.h>
 #include <sorting_network_cpp/networks/batcher_odd_even_merge_sort.h>
 #include <sorting_network_cpp/networks/bitonic_merge_sort.h>
 #include <sorting_network_cpp/networks/bose_nelson_sort.h>
 #include <sorting_network_cpp/networks/bubble_sort.h>
 #include <sorting_network_cpp/networks/insertion_sort.h>
+#include <sorting_network_cpp/networks/odd_even_transposition_sort.h>
+#include <sorting_network_cpp/networks/pairwise_sort.h>
+#include <sorting_network_cpp/networks/presorted_runs.h>
+#include <sorting_network_cpp/networks/rank_sort.h>
 #include <sorting_network_cpp/networks/size_optimized_sort.h>
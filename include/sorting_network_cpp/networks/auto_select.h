@@ -0,0 +1,75 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <sorting_network_cpp/networks/batcher_odd_even_merge_sort.h>
+#include <sorting_network_cpp/networks/bitonic_merge_sort.h>
+#include <sorting_network_cpp/networks/bose_nelson_sort.h>
+#include <sorting_network_cpp/networks/bubble_sort.h>
+#include <sorting_network_cpp/networks/insertion_sort.h>
+#include <sorting_network_cpp/networks/odd_even_transposition_sort.h>
+#include <sorting_network_cpp/networks/pairwise_sort.h>
+#include <sorting_network_cpp/networks/rank_sort.h>
+#include <sorting_network_cpp/networks/size_optimized_sort.h>
+
+namespace quxflux::sorting_net::detail
+{
+  // Network types in order of preference for sorting n values of type T.
+  // The default prefers type::bose_nelson_sort for every type and n; tables
+  // generated by scripts/autotune.py specialize this template for the
+  // benchmarked value types.
+  template<typename T, typename = void>
+  struct auto_select_table
+  {
+    static constexpr std::array<type, 1> candidates(const std::size_t) { return {type::bose_nelson_sort}; }
+  };
+
+  // The network of type::auto_select independent of the value type (e.g. for
+  // available_v); the network actually used is chosen by resolve_network_type
+  template<std::size_t N>
+  struct sorting_network<N, type::auto_select> : sorting_network<N, type::bose_nelson_sort>
+  {};
+
+  template<typename T, std::size_t N>
+  struct resolve_network_type<T, N, type::auto_select>
+  {
+  private:
+    template<std::size_t... Is>
+    static constexpr bool is_available(const type t, std::index_sequence<Is...>)
+    {
+      return ((t == static_cast<type>(Is) && available_v<N, static_cast<type>(Is)>) || ...);
+    }
+
+    static constexpr type select()
+    {
+      for (const type t : auto_select_table<T>::candidates(N))
+        if (is_available(t, std::make_index_sequence<static_cast<std::size_t>(type::auto_select)>{}))
+          return t;
+
+      return type::bose_nelson_sort;
+    }
+
+  public:
+    static constexpr type value = select();
+  };
+}  // namespace quxflux::sorting_net::detail
+
+#if defined(SORTING_NETWORK_CPP_AUTO_SELECT_TABLE)
+#include SORTING_NETWORK_CPP_AUTO_SELECT_TABLE
+#endif
@@ -20,54 +20,83 @@
 
 namespace quxflux::sorting_net::detail
 {
-  // Generates a sorting network based the construction scheme
-  // by Ken Batcher
+  // Generates a sorting network based the construction scheme by Ken Batcher
+  // in the merge exchange formulation for arbitrary N (Knuth, TAOCP Vol. 3,
+  // 5.2.2, Algorithm M): with 2^t >= N, the network consists of the passes
+  // p = 2^(t - 1), ..., 2, 1, each of which orders the subsequences of the
+  // indices with equal bits below p by comparing index i to i + d for all i
+  // whose bit p equals r in layers (d = p, r = 0) and (d = q - p, r = p) for
+  // q = 2^(t - 1), ..., 2 * p. Comparators beyond the last index are omitted.
   template<std::size_t N>
-  struct sorting_network<N, type::batcher_odd_even_merge_sort, std::enable_if_t<is_power_of_two(N)>>
+  struct sorting_network<N, type::batcher_odd_even_merge_sort>
   {
   private:
-    template<std::size_t I, std::size_t J, std::size_t R, typename = void>
-    struct gen_merge
+    static constexpr std::size_t Top = next_power_of_two(N) / 2_z;
+
+    // The k-th index i < N - D with (i & P) == R
+    template<std::size_t P, std::size_t D, std::size_t R>
+    static constexpr std::size_t nth_index(std::size_t k)
     {
-      using type = sorting_net::layer<sorting_net::cas_node<I, (I + R)>>;
-    };
+      std::size_t i = 0;
+
+      for (; i + D < N; ++i)
+        if ((i & P) == R && k-- == 0_z)
+          break;
+
+      return i;
+    }
 
-    template<std::size_t I, std::size_t J, std::size_t R>
-    struct gen_merge<I, J, R, std::enable_if_t<(R * 2_z <= J - I)>>
+    template<std::size_t P, std::size_t D, std::size_t R>
+    static constexpr std::size_t num_indices()
     {
-      static constexpr std::size_t step = R * 2_z;
+      std::size_t result = 0;
 
+      for (std::size_t i = 0; i + D < N; ++i)
+        result += (i & P) == R ? 1_z : 0_z;
+
+      return result;
+    }
+
+    template<std::size_t P, std::size_t D, std::size_t R>
+    struct gen_exchange
+    {
       template<std::size_t... Indices>
       static auto gen_cas(std::index_sequence<Indices...>)
-        -> sorting_net::layer<sorting_net::cas_node<I + R + Indices * step, I + R + Indices * step + R>...>
+        -> sorting_net::layer<sorting_net::cas_node<nth_index<P, D, R>(Indices), nth_index<P, D, R>(Indices) + D>...>
       {
         return {};
       }
 
-      using type =
-        sorting_net::layer<typename gen_merge<I, J, step>::type, typename gen_merge<I + R, J, step>::type,
-                           decltype(gen_cas(std::make_index_sequence<int_div_ceil((J - R) - (I + R), step)>()))>;
+      using type = decltype(gen_cas(std::make_index_sequence<num_indices<P, D, R>()>()));
     };
 
-    template<std::size_t Lo, std::size_t Hi, typename = void>
-    struct gen_sort
+    template<std::size_t P, std::size_t Q, typename = void>
+    struct gen_exchanges
     {
       using type = sorting_net::layer<>;
     };
 
-    template<std::size_t Lo, std::size_t Hi>
-    struct gen_sort<Lo, Hi, std::enable_if_t<(Hi - Lo >= 1_z)>>
+    template<std::size_t P, std::size_t Q>
+    struct gen_exchanges<P, Q, std::enable_if_t<(Q > P)>>
     {
-      static constexpr std::size_t Mid = Lo + (Hi - Lo) / 2_z;
+      using type =
+        sorting_net::layer<typename gen_exchange<P, Q - P, P>::type, typename gen_exchanges<P, Q / 2_z>::type>;
+    };
 
-      using type = sorting_net::layer<           //
-        typename gen_sort<Lo, Mid>::type,        //
-        typename gen_sort<Mid + 1_z, Hi>::type,  //
-        typename gen_merge<Lo, Hi, 1_z>::type    //
-        >;
+    template<std::size_t P, typename = void>
+    struct gen_pass
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t P>
+    struct gen_pass<P, std::enable_if_t<(P > 0_z)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<P, P, 0_z>::type, typename gen_exchanges<P, Top>::type,
+                                      typename gen_pass<P / 2_z>::type>;
     };
 
   public:
-    using type = sorting_net::net<typename gen_sort<0_z, N - 1_z>::type>;
+    using type = sorting_net::net<typename gen_pass<Top>::type>;
   };
 }  // namespace quxflux::sorting_net
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace quxflux::sorting_net
 {
@@ -36,17 +40,44 @@ namespace quxflux::sorting_net
     bose_nelson_sort,
     batcher_odd_even_merge_sort,
     bitonic_merge_sort,
-    size_optimized_sort
+    size_optimized_sort,
+    rank_sort,
+    odd_even_transposition_sort,
+    pairwise_sort,
+    auto_select
   };
 
+  // Compare and swap operation which evaluates the predicate once and swaps
+  // the values only if they are out of order; avoids the copies of
+  // compare_and_swap for types which are expensive to copy (e.g. std::string)
+  template<typename T, typename Predicate>
+  struct move_compare_and_swap
+  {
+    constexpr void operator()(T& a, T& b) const noexcept
+    {
+      using std::swap;
+
+      if (Predicate{}(b, a))
+        swap(a, b);
+    }
+  };
+
+  // Branchless compare and swap operation for trivially copyable types; other
+  // types are handled by move_compare_and_swap
   template<typename T, typename Predicate>
   struct compare_and_swap
   {
     constexpr void operator()(T& a, T& b) const noexcept
     {
-      const T t = Predicate{}(a, b) ? a : b;
-      b = Predicate{}(a, b) ? b : a;
-      a = t;
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        const T t = Predicate{}(a, b) ? a : b;
+        b = Predicate{}(a, b) ? b : a;
+        a = t;
+      } else
+      {
+        move_compare_and_swap<T, Predicate>{}(a, b);
+      }
     }
   };
 
@@ -55,9 +86,17 @@ namespace quxflux::sorting_net
     template<typename It, typename CAS>
     struct iterator_compare_and_swap;
 
+    template<typename It, typename = void>
+    struct is_random_access_iterator : std::false_type
+    {};
+
     template<typename It>
-    static inline constexpr bool is_random_access_iterator_v =
-      std::is_same_v<typename std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>;
+    struct is_random_access_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+      : std::is_same<typename std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>
+    {};
+
+    template<typename It>
+    static inline constexpr bool is_random_access_iterator_v = is_random_access_iterator<It>::value;
   }  // namespace detail
 
   template<std::size_t A, std::size_t B>
@@ -116,6 +155,22 @@ namespace quxflux::sorting_net
       return result >>= 1;
     }
 
+    constexpr std::size_t next_power_of_two(const std::size_t n)
+    {
+      std::size_t result = 1;
+
+      while (result < n)
+        result <<= 1;
+
+      return result;
+    }
+
+    // Smallest unsigned type which can represent the indices 0 ... N - 1
+    template<std::size_t N>
+    using index_type_t = std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max() + 1_z), std::uint8_t,
+                                            std::conditional_t<(N <= std::numeric_limits<std::uint16_t>::max() + 1_z),
+                                                               std::uint16_t, std::size_t>>;
+
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
     constexpr T int_div_ceil(const T x, const T y)
     {
@@ -124,6 +179,114 @@ namespace quxflux::sorting_net
 
     template<std::size_t N, type NWT, typename = void>
     struct sorting_network;
+
+    // The network type actually used to sort N values of type T when
+    // NetworkType is requested; specialized for type::auto_select
+    template<typename T, std::size_t N, type NetworkType>
+    struct resolve_network_type : std::integral_constant<type, NetworkType>
+    {};
+
+    // Runtime representation of a cas_node
+    struct comparator
+    {
+      std::size_t a = 0;
+      std::size_t b = 0;
+    };
+
+    template<std::size_t A, std::size_t B>
+    constexpr std::size_t num_comparators(const cas_node<A, B>)
+    {
+      return 1_z;
+    }
+
+    template<typename... LayerOrCas>
+    constexpr std::size_t num_comparators(const layer<LayerOrCas...>)
+    {
+      return (0_z + ... + num_comparators(LayerOrCas{}));
+    }
+
+    template<typename... Layers>
+    constexpr std::size_t num_comparators(const net<Layers...>)
+    {
+      return (0_z + ... + num_comparators(Layers{}));
+    }
+
+    template<std::size_t Size, std::size_t A, std::size_t B>
+    constexpr std::size_t flatten(const cas_node<A, B>, std::array<comparator, Size>& out, const std::size_t i)
+    {
+      out[i] = comparator{A, B};
+      return i + 1_z;
+    }
+
+    template<std::size_t Size, typename... LayerOrCas>
+    constexpr std::size_t flatten(const layer<LayerOrCas...>, std::array<comparator, Size>& out, std::size_t i)
+    {
+      ((i = flatten(LayerOrCas{}, out, i)), ...);
+      return i;
+    }
+
+    template<std::size_t Size, typename... Layers>
+    constexpr std::size_t flatten(const net<Layers...>, std::array<comparator, Size>& out, std::size_t i)
+    {
+      ((i = flatten(Layers{}, out, i)), ...);
+      return i;
+    }
+
+    // Flattened representation of a network: the comparators in order of
+    // execution and the index of the layer each comparator belongs to when the
+    // comparators are scheduled as early as possible
+    template<typename Network>
+    struct flattened_network
+    {
+    private:
+      static constexpr std::array<comparator, num_comparators(Network{})> make_comparators()
+      {
+        std::array<comparator, num_comparators(Network{})> result{};
+        flatten(Network{}, result, 0_z);
+        return result;
+      }
+
+      static constexpr std::size_t num_channels()
+      {
+        std::size_t result = 0;
+
+        for (const auto& c : comparators)
+          result = std::max({result, c.a + 1_z, c.b + 1_z});
+
+        return result;
+      }
+
+      static constexpr std::array<std::size_t, num_comparators(Network{})> make_layers()
+      {
+        std::array<std::size_t, num_comparators(Network{})> result{};
+        std::array<std::size_t, num_channels()> channel_depth{};
+
+        for (std::size_t i = 0; i < comparators.size(); ++i)
+        {
+          const auto [a, b] = comparators[i];
+
+          result[i] = std::max(channel_depth[a], channel_depth[b]);
+          channel_depth[a] = channel_depth[b] = result[i] + 1_z;
+        }
+
+        return result;
+      }
+
+      static constexpr std::size_t make_depth()
+      {
+        std::size_t result = 0;
+
+        for (const auto layer : layers)
+          result = std::max(result, layer + 1_z);
+
+        return result;
+      }
+
+    public:
+      static constexpr std::array<comparator, num_comparators(Network{})> comparators = make_comparators();
+      static constexpr std::array<std::size_t, num_comparators(Network{})> layers = make_layers();
+      static constexpr std::size_t depth = make_depth();
+    };
   }  // namespace detail
 
   template<std::size_t N, type Network, typename = void>
@@ -137,7 +300,154 @@ namespace quxflux::sorting_net
   template<std::size_t N, type Network>
   constexpr bool available_v = available<N, Network>::value;
 
-  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  // Execution policies which can be passed as first argument to
+  // sorting_network::operator() to select how the comparators access the values
+  namespace execution
+  {
+    // Every comparator accesses the values through the iterator
+    struct in_place_policy
+    {};
+
+    // The values are loaded into a local array, the comparators are executed
+    // on it and the values are stored back once; since the local array can not
+    // alias any other memory, the compiler is free to keep the values in
+    // registers. Requires a trivially copyable value type.
+    struct registers_policy
+    {};
+
+    // registers_policy for contiguous iterators (pointers, iterators of
+    // std::vector or, when compiled as C++20, every std::contiguous_iterator)
+    // over trivially copyable values, in_place_policy otherwise
+    struct automatic_policy
+    {};
+
+    // The comparators are stored as a table of index pairs (one byte per index
+    // for up to 256 values) and executed through the iterator in a loop instead
+    // of being unrolled. The generated code is of constant size, which reduces
+    // the instruction cache pressure of large networks (or of many instantiated
+    // networks) at the cost of loading the indices and the loop overhead.
+    struct compact_policy
+    {};
+
+    static inline constexpr in_place_policy in_place{};
+    static inline constexpr registers_policy registers{};
+    static inline constexpr automatic_policy automatic{};
+    static inline constexpr compact_policy compact{};
+
+    template<typename T>
+    static inline constexpr bool is_execution_policy_v =
+      std::is_same_v<T, in_place_policy> || std::is_same_v<T, registers_policy> ||
+      std::is_same_v<T, automatic_policy> || std::is_same_v<T, compact_policy>;
+  }  // namespace execution
+
+  namespace detail
+  {
+    template<typename It, typename T = typename std::iterator_traits<It>::value_type>
+    static inline constexpr bool is_contiguous_iterator_v =
+#if defined(__cpp_lib_concepts)
+      std::contiguous_iterator<It> ||
+#endif
+      std::is_pointer_v<It> || (!std::is_same_v<T, bool> && std::is_same_v<It, typename std::vector<T>::iterator>);
+
+    template<typename It, typename CAS, typename Network, std::size_t... Is>
+    constexpr void apply_in_registers(const It begin, const CAS& cas, const Network network,
+                                      std::index_sequence<Is...>) noexcept
+    {
+      std::array<typename std::iterator_traits<It>::value_type, sizeof...(Is)> values{begin[Is]...};
+
+      apply(values.data(), cas, network);
+
+      ((begin[Is] = values[Is]), ...);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::in_place_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      apply(begin, cas, network);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::registers_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      static_assert(std::is_trivially_copyable_v<typename std::iterator_traits<It>::value_type>,
+                    "execution::registers requires a trivially copyable value type");
+
+      apply_in_registers(begin, cas, network, std::make_index_sequence<N>{});
+    }
+
+    // The comparators of Network as pairs of the smallest index type
+    template<std::size_t N, typename Network>
+    struct compact_network
+    {
+    private:
+      using index_pair = std::array<index_type_t<N>, 2>;
+      using flattened = flattened_network<Network>;
+
+      static constexpr std::array<index_pair, flattened::comparators.size()> make_comparators()
+      {
+        std::array<index_pair, flattened::comparators.size()> result{};
+
+        for (std::size_t i = 0; i < result.size(); ++i)
+          result[i] = {static_cast<index_type_t<N>>(flattened::comparators[i].a),
+                       static_cast<index_type_t<N>>(flattened::comparators[i].b)};
+
+        return result;
+      }
+
+    public:
+      static constexpr std::array<index_pair, flattened::comparators.size()> comparators = make_comparators();
+    };
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::compact_policy, const It begin, const CAS& cas, const Network) noexcept
+    {
+      for (const auto& [a, b] : compact_network<N, Network>::comparators)
+        iterator_compare_and_swap<It, CAS>()(begin + a, begin + b, cas);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::automatic_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      if constexpr (is_contiguous_iterator_v<It> &&
+                    std::is_trivially_copyable_v<typename std::iterator_traits<It>::value_type>)
+        execute<N>(execution::registers, begin, cas, network);
+      else
+        execute<N>(execution::in_place, begin, cas, network);
+    }
+
+    // Sorts N values by executing the comparators of the network of
+    // NetworkType; specialized for network types which sort differently
+    template<std::size_t N, type NetworkType>
+    struct sorter
+    {
+      template<typename ExecutionPolicy, typename It, typename CAS>
+      static constexpr void sort(const ExecutionPolicy policy, const It begin, const CAS& cas) noexcept
+      {
+        execute<N>(policy, begin, cas, typename sorting_network<N, NetworkType>::type{});
+      }
+    };
+  }  // namespace detail
+
+  // Describes inputs which begin with runs of values which are in order
+  // already: the first RunLengths[0] values are sorted, the next RunLengths[1]
+  // values are sorted and so on; the values after the runs are in arbitrary
+  // order. presorted_runs<> describes inputs in arbitrary order.
+  template<std::size_t... RunLengths>
+  struct presorted_runs
+  {};
+
+  namespace detail
+  {
+    // Network without the comparators which never swap values of inputs
+    // described by Presorted (defined in networks/presorted_runs.h)
+    template<std::size_t N, typename Network, typename Presorted>
+    struct prune_presorted;
+  }  // namespace detail
+
+  // Sorts N values with the network of NetworkType. If the input is known to
+  // consist of presorted runs (see presorted_runs), the comparators which never
+  // swap values of such inputs are removed at compile time.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort, typename Presorted = presorted_runs<>>
   struct sorting_network
   {
     static_assert(N > 0);
@@ -148,8 +458,28 @@ namespace quxflux::sorting_net
              typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
     constexpr void operator()(const It begin, const CompareAndSwap& cas = {}) const noexcept
     {
-      if constexpr (N > 1)
-        apply(begin, cas, typename detail::sorting_network<N, NetworkType>::type{});
+      (*this)(execution::automatic, begin, cas);
+    }
+
+    template<typename ExecutionPolicy, typename It,
+             typename CompareAndSwap = compare_and_swap<typename std::iterator_traits<It>::value_type,
+                                                        std::less<typename std::iterator_traits<It>::value_type>>,
+             typename = std::enable_if_t<execution::is_execution_policy_v<ExecutionPolicy> &&
+                                         detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const ExecutionPolicy policy, const It begin,
+                              const CompareAndSwap& cas = {}) const noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+      constexpr type network_type = detail::resolve_network_type<value_type, N, NetworkType>::value;
+
+      if constexpr (N > 1 && std::is_same_v<Presorted, presorted_runs<>>)
+      {
+        detail::sorter<N, network_type>::sort(policy, begin, cas);
+      } else if constexpr (N > 1)
+      {
+        using network = typename detail::sorting_network<N, network_type>::type;
+        detail::execute<N>(policy, begin, cas, typename detail::prune_presorted<N, network, Presorted>::type{});
+      }
     }
   };
 }  // namespace quxflux::sorting_net
@@ -0,0 +1,111 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+namespace quxflux::sorting_net::detail
+{
+  // Generates the pairwise sorting network by Ian Parberry for arbitrary N:
+  // the values are first sorted in pairs of growing distance a = 1, 2, 4, ...
+  // (index i compared to i + a for all i with (i & a) == 0), afterwards the
+  // pairs are merged by comparing index i + d * a to i + (d + 1) * a for
+  // a = 2^(t - 2), ..., 2, 1 (2^t >= N) and d = e, e / 2, ..., 1 with
+  // e = 2^(t - 2) / a * 2 - 1. The network has as many comparators and layers
+  // as batcher_odd_even_merge_sort for powers of two, but the comparators of a
+  // layer are all of the same distance. Comparators beyond the last index are
+  // omitted.
+  template<std::size_t N>
+  struct sorting_network<N, type::pairwise_sort>
+  {
+  private:
+    // The k-th index i >= Start which lies in the first half of a block of
+    // size 2 * A relative to Start
+    template<std::size_t Start, std::size_t A>
+    static constexpr std::size_t nth_index(const std::size_t k)
+    {
+      return Start + k / A * 2_z * A + k % A;
+    }
+
+    template<std::size_t Start, std::size_t A>
+    static constexpr std::size_t num_indices()
+    {
+      std::size_t result = 0;
+
+      while (nth_index<Start, A>(result) < N)
+        ++result;
+
+      return result;
+    }
+
+    // Compares every index i above to i - Distance
+    template<std::size_t Start, std::size_t A, std::size_t Distance>
+    struct gen_exchange
+    {
+      template<std::size_t... Indices>
+      static auto gen_cas(std::index_sequence<Indices...>) -> sorting_net::layer<
+        sorting_net::cas_node<nth_index<Start, A>(Indices) - Distance, nth_index<Start, A>(Indices)>...>
+      {
+        return {};
+      }
+
+      using type = decltype(gen_cas(std::make_index_sequence<num_indices<Start, A>()>()));
+    };
+
+    template<std::size_t A, typename = void>
+    struct gen_pairs
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A>
+    struct gen_pairs<A, std::enable_if_t<(A < N)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<A, A, A>::type, typename gen_pairs<A * 2_z>::type>;
+    };
+
+    template<std::size_t A, std::size_t D, typename = void>
+    struct gen_merge_layers
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A, std::size_t D>
+    struct gen_merge_layers<A, D, std::enable_if_t<(D > 0_z)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<(D + 1_z) * A, A, D * A>::type,
+                                      typename gen_merge_layers<A, D / 2_z>::type>;
+    };
+
+    template<std::size_t A, std::size_t E, typename = void>
+    struct gen_merge
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A, std::size_t E>
+    struct gen_merge<A, E, std::enable_if_t<(A > 0_z)>>
+    {
+      using type =
+        sorting_net::layer<typename gen_merge_layers<A, E>::type, typename gen_merge<A / 2_z, E * 2_z + 1_z>::type>;
+    };
+
+  public:
+    using type = sorting_net::net<typename gen_pairs<1_z>::type,
+                                  typename gen_merge<next_power_of_two(N) / 4_z, 1_z>::type>;
+  };
+}  // namespace quxflux::sorting_net::detail
@@ -0,0 +1,160 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace quxflux::sorting_net::detail
+{
+  // The largest number of groups of up to 64 inputs of zeros and ones which
+  // are evaluated to prune a network for presorted runs
+  static inline constexpr std::size_t max_presorted_input_groups = 1_z << 9;
+
+  // Removes the comparators of Network which never swap values if the input
+  // consists of the presorted runs RunLengths followed by values in arbitrary
+  // order. A run of L sorted zeros and ones is one of L + 1 sequences (zeros
+  // followed by ones), every other value is either zero or one. All inputs of
+  // zeros and ones which adhere to the runs are evaluated, 64 inputs at once.
+  // By the 0-1 principle, a comparator which swaps no values of those inputs
+  // does not swap values of any input which adheres to the runs.
+  template<std::size_t N, typename Network, std::size_t... RunLengths>
+  struct prune_presorted<N, Network, presorted_runs<RunLengths...>>
+  {
+  private:
+    static constexpr std::array<std::size_t, sizeof...(RunLengths)> run_lengths{RunLengths...};
+    static constexpr std::size_t num_presorted = (0_z + ... + RunLengths);
+    static_assert(num_presorted <= N, "the presorted runs exceed the number of values");
+
+    // the inputs are enumerated as all values in arbitrary order (in groups of
+    // up to 64 inputs) for every combination of the sequences of the runs
+    static constexpr std::size_t num_arbitrary_inputs = 1_z << (N - num_presorted);
+    static constexpr std::size_t group_size = std::min(num_arbitrary_inputs, 64_z);
+    static constexpr std::size_t num_run_inputs = (1_z * ... * (RunLengths + 1_z));
+    static constexpr std::size_t num_groups = num_run_inputs * (num_arbitrary_inputs / group_size);
+
+    static_assert(num_groups <= max_presorted_input_groups,
+                  "too many inputs to prune the network for the presorted runs at compile time");
+
+    using words = std::array<std::uint64_t, int_div_ceil(num_run_inputs * num_arbitrary_inputs, 64_z)>;
+    using flattened = flattened_network<Network>;
+
+    static constexpr std::array<words, N> make_inputs()
+    {
+      // bit k of the word of the value j < 6 in arbitrary order is bit j of k
+      constexpr std::array<std::uint64_t, 6> low_bits{0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0,
+                                                      0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000};
+      constexpr std::uint64_t group_mask =
+        group_size == 64_z ? ~std::uint64_t{0} : (std::uint64_t{1} << group_size) - 1_z;
+
+      std::array<words, N> result{};
+
+      for (std::size_t group = 0; group < num_groups; ++group)
+      {
+        const std::size_t first_input = group * group_size;
+        auto set_bits = [&, w = first_input / 64_z, shift = first_input % 64_z](const std::size_t i,
+                                                                                  const std::uint64_t bits) {
+          result[i][w] |= (bits & group_mask) << shift;
+        };
+
+        // the digits of the run input are the number of ones of each run
+        std::size_t digits = first_input / num_arbitrary_inputs;
+        std::size_t i = 0;
+
+        for (const std::size_t length : run_lengths)
+        {
+          const std::size_t num_ones = digits % (length + 1_z);
+          digits /= length + 1_z;
+
+          for (std::size_t j = 0; j < length; ++j, ++i)
+            set_bits(i, j >= length - num_ones ? ~std::uint64_t{0} : 0);
+        }
+
+        const std::size_t arbitrary_group = first_input % num_arbitrary_inputs / group_size;
+
+        for (std::size_t j = 0; i < N; ++i, ++j)
+          set_bits(i, j < 6 ? low_bits[j] : ((arbitrary_group >> (j - 6)) & 1 ? ~std::uint64_t{0} : 0));
+      }
+
+      return result;
+    }
+
+    static constexpr std::array<bool, flattened::comparators.size()> make_swaps()
+    {
+      std::array<bool, flattened::comparators.size()> result{};
+      std::array<words, N> values = make_inputs();
+
+      for (std::size_t c = 0; c < flattened::comparators.size(); ++c)
+      {
+        words& a = values[flattened::comparators[c].a];
+        words& b = values[flattened::comparators[c].b];
+        std::uint64_t swapped = 0;
+
+        for (std::size_t w = 0; w < a.size(); ++w)
+        {
+          const std::uint64_t a_cpy = a[w];
+
+          swapped |= a_cpy & ~b[w];
+          a[w] &= b[w];
+          b[w] |= a_cpy;
+        }
+
+        result[c] = swapped != 0;
+      }
+
+      return result;
+    }
+
+    static constexpr std::array<bool, flattened::comparators.size()> swaps = make_swaps();
+
+    static constexpr std::size_t num_remaining()
+    {
+      std::size_t result = 0;
+
+      for (const bool s : swaps)
+        result += s ? 1_z : 0_z;
+
+      return result;
+    }
+
+    static constexpr std::array<comparator, num_remaining()> make_remaining()
+    {
+      std::array<comparator, num_remaining()> result{};
+
+      for (std::size_t c = 0, i = 0; c < swaps.size(); ++c)
+        if (swaps[c])
+          result[i++] = flattened::comparators[c];
+
+      return result;
+    }
+
+    static constexpr std::array<comparator, num_remaining()> remaining = make_remaining();
+
+    template<std::size_t... Indices>
+    static auto gen_cas(std::index_sequence<Indices...>)
+      -> sorting_net::layer<sorting_net::cas_node<remaining[Indices].a, remaining[Indices].b>...>
+    {
+      return {};
+    }
+
+  public:
+    using type = sorting_net::net<decltype(gen_cas(std::make_index_sequence<num_remaining()>()))>;
+  };
+}  // namespace quxflux::sorting_net::detail
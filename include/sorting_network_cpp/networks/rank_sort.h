@@ -0,0 +1,115 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/bose_nelson_sort.h>
+#include <sorting_network_cpp/networks/common.h>
+
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace quxflux::sorting_net::detail
+{
+  // type::rank_sort is no comparator network: every value is compared to all
+  // other values to count the values preceding it (its rank), and is stored at
+  // its rank afterwards. The network representation of type::rank_sort, which
+  // is used when comparators are required (e.g. with custom compare and swap
+  // operations, counting_compare_and_swap or the vector backends), is the one
+  // of type::bose_nelson_sort.
+  template<std::size_t N>
+  struct sorting_network<N, type::rank_sort, std::enable_if_t<(N <= 16)>> : sorting_network<N, type::bose_nelson_sort>
+  {};
+
+  // The predicate of the compare and swap operations provided by the library
+  template<typename CAS>
+  struct compare_and_swap_predicate
+  {};
+
+  template<typename T, typename Predicate>
+  struct compare_and_swap_predicate<compare_and_swap<T, Predicate>>
+  {
+    using type = Predicate;
+  };
+
+  template<typename T, typename Predicate>
+  struct compare_and_swap_predicate<move_compare_and_swap<T, Predicate>>
+  {
+    using type = Predicate;
+  };
+
+  template<typename CAS, typename = void>
+  struct has_compare_and_swap_predicate : std::false_type
+  {};
+
+  template<typename CAS>
+  struct has_compare_and_swap_predicate<CAS, std::void_t<typename compare_and_swap_predicate<CAS>::type>>
+    : std::true_type
+  {};
+
+  template<std::size_t N>
+  struct sorter<N, type::rank_sort>
+  {
+  private:
+    // Of two values, the smaller one precedes the other; of two equal values,
+    // the one with the lower index precedes the other, which makes the sort
+    // stable
+    template<typename Predicate, std::size_t I, std::size_t J, typename T>
+    static constexpr void count_preceding(const std::array<T, N>& values, std::array<std::size_t, N>& ranks) noexcept
+    {
+      const std::size_t j_precedes_i = Predicate{}(values[J], values[I]) ? 1 : 0;
+
+      ranks[I] += j_precedes_i;
+      ranks[J] += 1 - j_precedes_i;
+    }
+
+    template<typename Predicate, std::size_t I, typename T, std::size_t... Js>
+    static constexpr void count_preceding(const std::array<T, N>& values, std::array<std::size_t, N>& ranks,
+                                          std::index_sequence<Js...>) noexcept
+    {
+      (count_preceding<Predicate, I, I + 1 + Js>(values, ranks), ...);
+    }
+
+    template<typename Predicate, typename It, std::size_t... Is>
+    static constexpr void rank_sort(const It begin, std::index_sequence<Is...>) noexcept
+    {
+      const std::array<typename std::iterator_traits<It>::value_type, N> values{begin[Is]...};
+      std::array<std::size_t, N> ranks{};
+
+      // every pair of values is compared once
+      (count_preceding<Predicate, Is>(values, ranks, std::make_index_sequence<N - 1 - Is>{}), ...);
+
+      ((begin[ranks[Is]] = values[Is]), ...);
+    }
+
+  public:
+    // Only the compare and swap operations provided by the library define the
+    // order by a predicate the ranks can be computed with; all others (and
+    // values which are not trivially copyable) are sorted by the network
+    template<typename ExecutionPolicy, typename It, typename CAS>
+    static constexpr void sort(const ExecutionPolicy policy, const It begin, const CAS& cas) noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+
+      if constexpr (has_compare_and_swap_predicate<CAS>::value && std::is_trivially_copyable_v<value_type>)
+        rank_sort<typename compare_and_swap_predicate<CAS>::type>(begin, std::make_index_sequence<N>{});
+      else
+        execute<N>(policy, begin, cas, typename sorting_network<N, type::rank_sort>::type{});
+    }
+  };
+}  // namespace quxflux::sorting_net::detail
@@ -0,0 +1,108 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <iterator>
+#include <type_traits>
+
+namespace quxflux::sorting_net
+{
+  namespace detail
+  {
+    // Removes the comparators of a network for more than N values which do
+    // nothing when the values at the indices >= N are padding values greater
+    // than all others (i.e. comparators whose maximum is a padding value)
+    template<std::size_t N, typename Node>
+    struct prune_padding;
+
+    template<std::size_t N, std::size_t A, std::size_t B>
+    struct prune_padding<N, cas_node<A, B>>
+    {
+      using type = std::conditional_t<(B < N), cas_node<A, B>, layer<>>;
+    };
+
+    template<std::size_t N, typename... LayerOrCas>
+    struct prune_padding<N, layer<LayerOrCas...>>
+    {
+      using type = layer<typename prune_padding<N, LayerOrCas>::type...>;
+    };
+
+    template<std::size_t N, typename... Layers>
+    struct prune_padding<N, net<Layers...>>
+    {
+      using type = net<typename prune_padding<N, Layers>::type...>;
+    };
+
+    // The padding values remain at the indices >= N unless a comparator moves
+    // the minimum to such an index and the maximum below N
+    template<std::size_t N, typename Network>
+    constexpr bool padding_remains_in_place()
+    {
+      for (const auto [a, b] : flattened_network<Network>::comparators)
+        if (a >= N && b < N)
+          return false;
+
+      return true;
+    }
+
+    template<std::size_t N, type NetworkType>
+    using padded_network_t = typename sorting_network<next_power_of_two(N), NetworkType>::type;
+  }  // namespace detail
+
+  template<std::size_t N, type NetworkType, typename = void>
+  struct padded_available : std::false_type
+  {};
+
+  template<std::size_t N, type NetworkType>
+  struct padded_available<N, NetworkType, std::enable_if_t<available_v<detail::next_power_of_two(N), NetworkType>>>
+    : std::bool_constant<detail::padding_remains_in_place<N, detail::padded_network_t<N, NetworkType>>()>
+  {};
+
+  // true if padded_sorting_network<N, NetworkType> is available
+  template<std::size_t N, type NetworkType>
+  constexpr bool padded_available_v = padded_available<N, NetworkType>::value;
+
+  // Sorts N values with the network of NetworkType for the next power of two
+  // of N: the values are virtually padded with values greater than all others,
+  // and all comparators whose maximum is such a padding value are removed at
+  // compile time, so no value beyond the N values is ever accessed. This makes
+  // networks which are only generated for powers of two usable for every N
+  // (batcher_odd_even_merge_sort omits the comparators beyond N itself, so the
+  // padded network equals the one for N). Not available for networks which
+  // move the minimum of a comparator to the higher index (e.g.
+  // bitonic_merge_sort) unless N is a power of two.
+  template<std::size_t N, type NetworkType = type::batcher_odd_even_merge_sort>
+  struct padded_sorting_network
+  {
+    static_assert(N > 0);
+    static_assert(padded_available_v<N, NetworkType>, "network type can not be padded to the next power of two");
+
+    using network = typename detail::prune_padding<N, detail::padded_network_t<N, NetworkType>>::type;
+
+    template<typename It,
+             typename CompareAndSwap = compare_and_swap<typename std::iterator_traits<It>::value_type,
+                                                        std::less<typename std::iterator_traits<It>::value_type>>,
+             typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const It begin, const CompareAndSwap& cas = {}) const noexcept
+    {
+      if constexpr (N > 1)
+        apply(begin, cas, network{});
+    }
+  };
+}  // namespace quxflux::sorting_net
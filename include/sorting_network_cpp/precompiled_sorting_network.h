@@ -0,0 +1,73 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <cstdint>
+#include <type_traits>
+
+// The combinations of value type, N and network type which are compiled into
+// the library sorting_network_cpp_precompiled; X is invoked as X(T, N, type)
+#define SORTING_NETWORK_CPP_PRECOMPILED_SIZES(X, T, NetworkType)                                                       \
+  X(T, 2, NetworkType) X(T, 3, NetworkType) X(T, 4, NetworkType) X(T, 5, NetworkType) X(T, 6, NetworkType)             \
+  X(T, 7, NetworkType) X(T, 8, NetworkType) X(T, 9, NetworkType) X(T, 10, NetworkType) X(T, 11, NetworkType)           \
+  X(T, 12, NetworkType) X(T, 13, NetworkType) X(T, 14, NetworkType) X(T, 15, NetworkType) X(T, 16, NetworkType)        \
+  X(T, 24, NetworkType)
+
+#define SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, T)                                                            \
+  SORTING_NETWORK_CPP_PRECOMPILED_SIZES(X, T, ::quxflux::sorting_net::type::bose_nelson_sort)                          \
+  SORTING_NETWORK_CPP_PRECOMPILED_SIZES(X, T, ::quxflux::sorting_net::type::batcher_odd_even_merge_sort)               \
+  SORTING_NETWORK_CPP_PRECOMPILED_SIZES(X, T, ::quxflux::sorting_net::type::size_optimized_sort)                       \
+  X(T, 32, ::quxflux::sorting_net::type::bose_nelson_sort)                                                             \
+  X(T, 32, ::quxflux::sorting_net::type::batcher_odd_even_merge_sort)
+
+#define SORTING_NETWORK_CPP_PRECOMPILED(X)                                                                             \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, std::int16_t)                                                       \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, std::int32_t)                                                       \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, std::uint32_t)                                                      \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, std::int64_t)                                                       \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, float)                                                              \
+  SORTING_NETWORK_CPP_PRECOMPILED_NETWORK_TYPES(X, double)
+
+namespace quxflux::sorting_net
+{
+  // Sorts the N values at begin in ascending order with the network of
+  // NetworkType. Only declared here: the definitions for the combinations
+  // listed by SORTING_NETWORK_CPP_PRECOMPILED are compiled once into the
+  // library sorting_network_cpp_precompiled, so translation units calling
+  // precompiled_sort do not instantiate the networks themselves.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort, typename T>
+  void precompiled_sort(T* begin) noexcept;
+
+  template<typename T, std::size_t N, type NetworkType>
+  struct precompiled_available : std::false_type
+  {};
+
+  template<typename T, std::size_t N, type NetworkType = type::bose_nelson_sort>
+  constexpr bool precompiled_available_v = precompiled_available<T, N, NetworkType>::value;
+
+#define SORTING_NETWORK_CPP_DECLARE_PRECOMPILED(T, N, NetworkType)                                                     \
+  template<>                                                                                                           \
+  struct precompiled_available<T, N, NetworkType> : std::true_type                                                     \
+  {};                                                                                                                  \
+  extern template void precompiled_sort<N, NetworkType, T>(T* begin) noexcept;
+
+  SORTING_NETWORK_CPP_PRECOMPILED(SORTING_NETWORK_CPP_DECLARE_PRECOMPILED)
+
+#undef SORTING_NETWORK_CPP_DECLARE_PRECOMPILED
+}  // namespace quxflux::sorting_net
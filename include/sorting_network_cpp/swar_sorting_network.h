@@ -0,0 +1,241 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace quxflux::sorting_net
+{
+  // true if N values of type T fit into the lanes of a single 64 bit word
+  template<typename T, std::size_t N>
+  static inline constexpr bool swar_available_v =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 4 && N * sizeof(T) <= sizeof(std::uint64_t);
+
+  namespace detail
+  {
+    template<std::size_t LaneBits>
+    constexpr std::uint64_t lane_mask(const std::size_t lane)
+    {
+      return ((std::uint64_t{1} << (LaneBits - 1)) * 2 - 1) << (lane * LaneBits);
+    }
+
+    template<std::size_t LaneBits>
+    constexpr std::uint64_t broadcast(const std::uint64_t value)
+    {
+      std::uint64_t result = 0;
+
+      for (std::size_t i = 0; i < 64 / LaneBits; ++i)
+        result |= value << (i * LaneBits);
+
+      return result;
+    }
+
+    // All ones in the lanes in which x is greater than or equal to y (unsigned
+    // comparison)
+    template<std::size_t LaneBits>
+    constexpr std::uint64_t swar_greater_equal(const std::uint64_t x, const std::uint64_t y) noexcept
+    {
+      constexpr std::uint64_t high_bits = broadcast<LaneBits>(std::uint64_t{1} << (LaneBits - 1));
+
+      // the high bit of each lane of low_ge is set if the lower bits of the
+      // lane of x are greater than or equal to the ones of y; the guarding
+      // high bit prevents borrows across lanes
+      const std::uint64_t low_ge = (x | high_bits) - (y & ~high_bits);
+      const std::uint64_t ge = ((x & ~y) | (~(x ^ y) & low_ge)) & high_bits;
+
+      // spread the high bit to all bits of the lane (the carry out of the
+      // topmost lane is discarded)
+      return (ge << 1) - (ge >> (LaneBits - 1));
+    }
+
+    template<typename T>
+    static inline constexpr std::uint64_t swar_sign_bits =
+      std::is_signed_v<T> ? broadcast<8 * sizeof(T)>(std::uint64_t{1} << (8 * sizeof(T) - 1)) : 0;
+
+    // Lanes which are moved by distance lanes towards the lower (lower_lanes)
+    // or the upper (upper_lanes) end of the word to meet their counterpart
+    struct swar_shift
+    {
+      std::size_t distance = 0;
+      std::uint64_t lower_lanes = 0;
+      std::uint64_t upper_lanes = 0;
+    };
+
+    // The comparators of one layer of a network as word level operations:
+    // min_lanes receive the minimum, max_lanes the maximum of the lane and its
+    // counterpart, all other lanes are left untouched
+    template<std::size_t N>
+    struct swar_layer
+    {
+      std::array<swar_shift, N> shifts{};
+      std::size_t num_shifts = 0;
+      std::uint64_t min_lanes = 0;
+      std::uint64_t max_lanes = 0;
+    };
+
+    template<typename Network, std::size_t N, std::size_t LaneBits>
+    struct swar_network
+    {
+    private:
+      using flattened = flattened_network<Network>;
+
+      static constexpr std::array<swar_layer<N>, flattened::depth> make_layers()
+      {
+        std::array<swar_layer<N>, flattened::depth> result{};
+
+        for (std::size_t i = 0; i < flattened::comparators.size(); ++i)
+        {
+          const auto [a, b] = flattened::comparators[i];
+          auto& layer = result[flattened::layers[i]];
+
+          const std::size_t lower = std::min(a, b);
+          const std::size_t upper = std::max(a, b);
+
+          std::size_t s = 0;
+          while (s < layer.num_shifts && layer.shifts[s].distance != upper - lower)
+            ++s;
+
+          if (s == layer.num_shifts)
+            layer.shifts[layer.num_shifts++].distance = upper - lower;
+
+          layer.shifts[s].lower_lanes |= lane_mask<LaneBits>(lower);
+          layer.shifts[s].upper_lanes |= lane_mask<LaneBits>(upper);
+          layer.min_lanes |= lane_mask<LaneBits>(a);
+          layer.max_lanes |= lane_mask<LaneBits>(b);
+        }
+
+        return result;
+      }
+
+      static constexpr std::array<swar_layer<N>, flattened::depth> layers = make_layers();
+
+      template<std::size_t L>
+      static constexpr std::uint64_t apply_layer(const std::uint64_t x) noexcept
+      {
+        constexpr const swar_layer<N>& layer = layers[L];
+
+        std::uint64_t y = 0;
+
+        for (std::size_t s = 0; s < layer.num_shifts; ++s)
+        {
+          const auto& shift = layer.shifts[s];
+          y |= ((x >> (shift.distance * LaneBits)) & shift.lower_lanes) |
+               ((x << (shift.distance * LaneBits)) & shift.upper_lanes);
+        }
+
+        // min lanes take the counterpart if it is smaller, max lanes if it is greater
+        const std::uint64_t ge = swar_greater_equal<LaneBits>(x, y);
+        const std::uint64_t take_y = (ge & layer.min_lanes) | (~ge & layer.max_lanes);
+
+        return x ^ ((x ^ y) & take_y);
+      }
+
+      template<std::size_t... Ls>
+      static constexpr std::uint64_t apply_layers(std::uint64_t x, std::index_sequence<Ls...>) noexcept
+      {
+        ((x = apply_layer<Ls>(x)), ...);
+        return x;
+      }
+
+    public:
+      static constexpr std::uint64_t apply(const std::uint64_t x) noexcept
+      {
+        return apply_layers(x, std::make_index_sequence<flattened::depth>{});
+      }
+    };
+  }  // namespace detail
+
+  // Compare and swap operation on 64 bit words holding 64 / (8 * sizeof(T))
+  // values of type T in independent lanes; every lane is compared and swapped
+  // separately. Used with sorting_network on a sequence of words, this sorts
+  // one array per lane at once (element i of all arrays is stored in word i).
+  template<typename T>
+  struct swar_compare_and_swap
+  {
+    static_assert(swar_available_v<T, 1>);
+
+    constexpr void operator()(std::uint64_t& a, std::uint64_t& b) const noexcept
+    {
+      constexpr std::uint64_t sign_bits = detail::swar_sign_bits<T>;
+
+      const std::uint64_t swap = (a ^ b) & detail::swar_greater_equal<8 * sizeof(T)>(a ^ sign_bits, b ^ sign_bits);
+      a ^= swap;
+      b ^= swap;
+    }
+  };
+
+  // Sorting network operating on N small integers packed into the lanes of a
+  // single 64 bit word (SIMD within a register): the comparators of each layer
+  // are executed at once by shifting every lane next to its counterpart and
+  // computing the lane wise minimum and maximum with bit operations. Values are
+  // sorted in ascending order. Networks with few distinct comparator distances
+  // per layer (e.g. batcher_odd_even_merge_sort, size_optimized_sort) need the
+  // fewest operations.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  struct swar_sorting_network
+  {
+    static_assert(N > 0);
+
+    // Sorts the N values of type T stored in the lanes of word; lane i occupies
+    // the bits [i * 8 * sizeof(T), (i + 1) * 8 * sizeof(T))
+    template<typename T>
+    static constexpr std::uint64_t sort_packed(const std::uint64_t word) noexcept
+    {
+      static_assert(swar_available_v<T, N>, "N values of type T do not fit into a 64 bit word");
+
+      constexpr std::size_t lane_bits = 8 * sizeof(T);
+      constexpr type network_type = detail::resolve_network_type<T, N, NetworkType>::value;
+
+      // flipping the sign bits maps the order of signed lanes to the order of unsigned lanes
+      constexpr std::uint64_t sign_bits = detail::swar_sign_bits<T>;
+
+      if constexpr (N > 1)
+      {
+        using network = typename detail::sorting_network<N, network_type>::type;
+        return detail::swar_network<network, N, lane_bits>::apply(word ^ sign_bits) ^ sign_bits;
+      } else
+      {
+        return word;
+      }
+    }
+
+    template<typename It, typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const It begin) const noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+      using unsigned_type = std::make_unsigned_t<value_type>;
+
+      constexpr std::size_t lane_bits = 8 * sizeof(value_type);
+
+      std::uint64_t word = 0;
+
+      for (std::size_t i = 0; i < N; ++i)
+        word |= std::uint64_t{static_cast<unsigned_type>(begin[i])} << (i * lane_bits);
+
+      word = sort_packed<value_type>(word);
+
+      for (std::size_t i = 0; i < N; ++i)
+        begin[i] = static_cast<value_type>(static_cast<unsigned_type>(word >> (i * lane_bits)));
+    }
+  };
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,210 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// The vector backend requires the vector extensions of GCC and Clang
+// including __builtin_shufflevector (GCC >= 12, Clang)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS
+#endif
+#endif
+
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+
+// vectors are only passed between inline functions, so the note that their
+// ABI depends on the enabled instruction sets does not apply
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace quxflux::sorting_net
+{
+  namespace detail
+  {
+    template<typename T, std::size_t Lanes>
+    struct vector_type
+    {
+      typedef T type __attribute__((vector_size(sizeof(T) * Lanes)));
+    };
+  }  // namespace detail
+
+  // Vector of Lanes values of type T; the compiler lowers the operations on it
+  // to the vector instructions available for the target (e.g. SSE2, AVX2 or
+  // AVX-512 depending on -march) or to scalar code
+  template<typename T, std::size_t Lanes>
+  using vector_t = typename detail::vector_type<T, Lanes>::type;
+
+  // true if values of type T can be stored in a vector_t
+  template<typename T>
+  static inline constexpr bool vector_available_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+  // Compare and swap operation on vectors; every lane is compared and swapped
+  // separately. Used with sorting_network on a sequence of vectors, this sorts
+  // one array per lane at once (element i of all arrays is stored in vector i).
+  template<typename T, std::size_t Lanes>
+  struct vector_compare_and_swap
+  {
+    static_assert(vector_available_v<T> && detail::is_power_of_two(Lanes));
+
+    void operator()(vector_t<T, Lanes>& a, vector_t<T, Lanes>& b) const noexcept
+    {
+      // written such that the compiler can use the lane wise min and max instructions
+      const vector_t<T, Lanes> min = a < b ? a : b;
+      b = a > b ? a : b;
+      a = min;
+    }
+  };
+
+  namespace detail
+  {
+    // Executes the layers of a network on a single vector holding all values;
+    // per layer each lane is shuffled next to its counterpart, and the lanes
+    // receiving the minimum and the maximum are blended from the lane wise
+    // minimum and maximum
+    template<typename Network, std::size_t Lanes>
+    struct vector_network
+    {
+    private:
+      using flattened = flattened_network<Network>;
+
+      static constexpr std::array<std::array<int, Lanes>, flattened::depth> make_permutations()
+      {
+        std::array<std::array<int, Lanes>, flattened::depth> result{};
+
+        for (auto& permutation : result)
+          for (std::size_t i = 0; i < Lanes; ++i)
+            permutation[i] = static_cast<int>(i);
+
+        for (std::size_t i = 0; i < flattened::comparators.size(); ++i)
+        {
+          const auto [a, b] = flattened::comparators[i];
+          result[flattened::layers[i]][a] = static_cast<int>(b);
+          result[flattened::layers[i]][b] = static_cast<int>(a);
+        }
+
+        return result;
+      }
+
+      static constexpr std::array<std::array<bool, Lanes>, flattened::depth> make_min_lanes()
+      {
+        std::array<std::array<bool, Lanes>, flattened::depth> result{};
+
+        for (std::size_t i = 0; i < flattened::comparators.size(); ++i)
+          result[flattened::layers[i]][flattened::comparators[i].a] = true;
+
+        return result;
+      }
+
+      static constexpr std::array<std::array<int, Lanes>, flattened::depth> permutations = make_permutations();
+      static constexpr std::array<std::array<bool, Lanes>, flattened::depth> min_lanes = make_min_lanes();
+
+      template<std::size_t L, typename V, std::size_t... Is>
+      static V apply_layer(const V v, std::index_sequence<Is...>) noexcept
+      {
+        using mask_t = decltype(v < v);
+
+        const V partner = __builtin_shufflevector(v, v, permutations[L][Is]...);
+        const mask_t takes_min{(min_lanes[L][Is] ? -1 : 0)...};
+
+        const auto less = v < partner;
+        const V min = less ? v : partner;
+        const V max = less ? partner : v;
+
+        return takes_min ? min : max;
+      }
+
+      template<typename V, std::size_t... Ls>
+      static V apply_layers(V v, std::index_sequence<Ls...>) noexcept
+      {
+        ((v = apply_layer<Ls>(v, std::make_index_sequence<Lanes>{})), ...);
+        return v;
+      }
+
+    public:
+      template<typename V>
+      static V apply(const V v) noexcept
+      {
+        return apply_layers(v, std::make_index_sequence<flattened::depth>{});
+      }
+    };
+  }  // namespace detail
+
+  // Sorting network which keeps all N values in a single vector of the next
+  // power of two lanes and executes all comparators of a layer at once
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  struct vector_sorting_network
+  {
+    static_assert(N > 0);
+
+    static constexpr std::size_t lanes = detail::next_power_of_two(N < 2 ? 2 : N);
+
+    // Sorts the first N lanes of v; the remaining lanes are left untouched
+    template<typename T>
+    static vector_t<T, lanes> sort_vector(const vector_t<T, lanes> v) noexcept
+    {
+      static_assert(vector_available_v<T>);
+
+      constexpr type network_type = detail::resolve_network_type<T, N, NetworkType>::value;
+
+      if constexpr (N > 1)
+        return detail::vector_network<typename detail::sorting_network<N, network_type>::type, lanes>::apply(v);
+      else
+        return v;
+    }
+
+    template<typename It, typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
+    void operator()(const It begin) const noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+
+      vector_t<value_type, lanes> v{};
+
+      if constexpr (std::is_pointer_v<It>)
+      {
+        std::memcpy(&v, begin, N * sizeof(value_type));
+        v = sort_vector<value_type>(v);
+        std::memcpy(begin, &v, N * sizeof(value_type));
+      } else
+      {
+        for (std::size_t i = 0; i < N; ++i)
+          v[i] = begin[i];
+
+        v = sort_vector<value_type>(v);
+
+        for (std::size_t i = 0; i < N; ++i)
+          begin[i] = v[i];
+      }
+    }
+  };
+}  // namespace quxflux::sorting_net
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,148 @@
+"""Generates the table used by type::auto_select from benchmark timings of the host.
+
+The benchmark (sorting_network_cpp_benchmark) is run on the target machine, or
+an existing table in the format of doc/benchmark_timings.csv is read, and for
+every benchmarked value type and problem size the network types are ranked by
+their execution time. The ranking is written as a header which is picked up by
+sorting_network_cpp/networks/auto_select.h when the macro
+SORTING_NETWORK_CPP_AUTO_SELECT_TABLE is defined to its path, e.g.
+
+  -DSORTING_NETWORK_CPP_AUTO_SELECT_TABLE=\\"sorting_network_cpp_auto_select.h\\"
+
+A problem size N which was not benchmarked uses the ranking of the next larger
+benchmarked size (or of the largest one). Network types which are not available
+for N are skipped; type::bose_nelson_sort is used if none is available.
+"""
+
+import argparse
+import os
+import statistics
+import sys
+
+from check_benchmark_regression import _read_table, _run_benchmark
+
+value_types = {
+    'int16_t': 'std::int16_t',
+    'int32_t': 'std::int32_t',
+    'uint32_t': 'std::uint32_t',
+    'int64_t': 'std::int64_t',
+    'float': 'float',
+    'double': 'double',
+}
+
+network_prefix = 'SN::'
+
+
+def _rankings(timings):
+    """Returns {data type: {N: [network types, fastest first]}} for {(data type, N): {algorithm: time}}."""
+    network_types = sorted(set(a[len(network_prefix):] for t in timings.values() for a in t
+                               if a.startswith(network_prefix) and a != network_prefix + 'auto_select'))
+    result = {}
+
+    for (data_type, n), times in timings.items():
+        if data_type not in value_types:
+            continue
+
+        # networks without a measurement (not available for N) are ranked last
+        # so that every ranking lists the same network types
+        ranking = sorted(network_types, key=lambda x: (network_prefix + x not in times,
+                                                       times.get(network_prefix + x, 0.0), x))
+        result.setdefault(data_type, {})[n] = ranking
+
+    return result
+
+
+def _format_return(ranking, indent: str):
+    """Returns the lines of a return statement of the ranking, wrapped at 120 columns."""
+    lines = [indent + 'return {']
+    continuation = ' ' * len(lines[0])
+
+    for i, x in enumerate(ranking):
+        item = f'type::{x}' + ('};' if i + 1 == len(ranking) else ',')
+
+        if lines[-1].endswith(',') and len(lines[-1]) + 1 + len(item) > 120:
+            lines.append(continuation + item)
+        else:
+            lines[-1] += (' ' if lines[-1].endswith(',') else '') + item
+
+    return lines
+
+
+def _make_header(rankings, source: str):
+    lines = [f'// Generated by scripts/autotune.py from {source}; do not edit.',
+             '// Included by sorting_network_cpp/networks/auto_select.h when SORTING_NETWORK_CPP_AUTO_SELECT_TABLE',
+             '// is defined to the path of this file.',
+             '',
+             '#pragma once',
+             '',
+             '#include <array>',
+             '#include <cstdint>',
+             '',
+             'namespace quxflux::sorting_net::detail',
+             '{']
+
+    for i, (data_type, ranking_per_size) in enumerate(sorted(rankings.items())):
+        sizes = sorted(ranking_per_size)
+        num_candidates = len(ranking_per_size[sizes[0]])
+
+        if i > 0:
+            lines.append('')
+
+        lines += ['  template<>',
+                  f'  struct auto_select_table<{value_types[data_type]}>',
+                  '  {',
+                  f'    static constexpr std::array<type, {num_candidates}> candidates(const std::size_t n)',
+                  '    {']
+
+        for n in sizes[:-1]:
+            lines += [f'      if (n <= {n})'] + _format_return(ranking_per_size[n], ' ' * 8)
+
+        lines += _format_return(ranking_per_size[sizes[-1]], ' ' * 6)
+        lines += ['    }', '  };']
+
+    lines += ['}  // namespace quxflux::sorting_net::detail', '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--benchmark', help='path of the sorting_network_cpp_benchmark executable which is run')
+    source.add_argument('--timings', help='existing benchmark table, e.g. doc/benchmark_timings.csv')
+    parser.add_argument('--compiler', help='compiler column value of the rows to use (required if the table '
+                                           'contains timings of more than one compiler)')
+    parser.add_argument('--runs', type=int, default=3, help='number of benchmark runs (default: 3)')
+    parser.add_argument('--output', default='sorting_network_cpp_auto_select.h',
+                        help='path of the generated header (default: sorting_network_cpp_auto_select.h)')
+    parser.add_argument('benchmark_args', nargs=argparse.REMAINDER,
+                        help='arguments passed to the benchmark after "--", e.g. -- --data-types=float,double')
+    args = parser.parse_args()
+
+    if args.benchmark:
+        benchmark_args = args.benchmark_args[1:] if args.benchmark_args[:1] == ['--'] else args.benchmark_args
+        table = {scenario: {a: statistics.median(t) for a, t in timings.items()}
+                 for scenario, timings in _run_benchmark(args.benchmark, benchmark_args, max(args.runs, 1)).items()}
+    else:
+        table = _read_table(args.timings)
+
+    compilers = sorted(set(compiler for compiler, _, _ in table))
+
+    if args.compiler is None and len(compilers) > 1:
+        parser.error(f'the timings contain more than one compiler, select one with --compiler: {", ".join(compilers)}')
+
+    compiler = args.compiler or (compilers[0] if compilers else None)
+    rankings = _rankings({(data_type, n): timings for (c, data_type, n), timings in table.items() if c == compiler})
+
+    if not rankings:
+        print(f'no timings of "{compiler}" for any of the value types {", ".join(value_types)}', file=sys.stderr)
+        return 1
+
+    source_name = os.path.basename(args.timings) if args.timings else 'a benchmark run'
+    open(args.output, 'w', encoding='utf8').write(_make_header(rankings, f'{source_name} ({compiler})'))
+    print(f'auto_select table written to {args.output}')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,174 @@
+"""Runs the benchmark several times and compares the results against a baseline table.
+
+The tables are the tab separated files written by sorting_network_cpp_benchmark
+(see doc/benchmark_timings.csv): one row per compiler, data type and N with one
+column of execution times (in ms) per algorithm.
+
+A measurement is considered a regression if its median over all runs is slower
+than the baseline by more than the relative tolerance plus the measured noise
+(relative standard deviation over the runs, scaled by --noise-sigma).
+
+The exit code is 1 if at least one regression was found, 0 otherwise.
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+dir_path = os.path.dirname(os.path.realpath(__file__))
+
+
+def _read_table(path: str):
+    """Returns {(compiler, data type, N): {algorithm: time}} for the table at path."""
+    lines = [x.rstrip('\r\n') for x in open(path, 'r', encoding='utf8') if x.strip()]
+
+    if not lines:
+        return {}
+
+    algorithms = [x for x in lines[0].split('\t')[3:] if x]
+    table = {}
+
+    for line in lines[1:]:
+        cells = line.split('\t')
+        timings = {}
+
+        for algorithm, cell in zip(algorithms, cells[3:]):
+            if cell.strip():
+                timings[algorithm] = float(cell)
+
+        table[(cells[0], cells[1], int(cells[2]))] = timings
+
+    return table
+
+
+def _write_table(path: str, table):
+    algorithms = sorted(set(a for timings in table.values() for a in timings))
+
+    with open(path, 'w', encoding='utf8') as f:
+        f.write('\t'.join(['compiler', 'data type', 'N'] + algorithms) + '\t\n')
+
+        for (compiler, data_type, n), timings in sorted(table.items()):
+            cells = [compiler, data_type, str(n)] + [f'{timings[a]:g}' if a in timings else ' ' for a in algorithms]
+            f.write('\t'.join(cells) + '\t\n')
+
+
+def _run_benchmark(executable: str, benchmark_args, runs: int):
+    """Runs the benchmark and returns {(compiler, data type, N): {algorithm: [time per run]}}."""
+    results = {}
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for run in range(runs):
+            print(f'benchmark run {run + 1}/{runs}', file=sys.stderr)
+
+            output_path = os.path.join(tmp_dir, f'timings_{run}.csv')
+            subprocess.run([executable, f'--output={output_path}'] + benchmark_args, check=True,
+                           stderr=subprocess.DEVNULL)
+
+            for scenario, timings in _read_table(output_path).items():
+                for algorithm, time in timings.items():
+                    results.setdefault(scenario, {}).setdefault(algorithm, []).append(time)
+
+    return results
+
+
+def _relative_noise(samples):
+    if len(samples) < 2:
+        return 0.0
+
+    return statistics.stdev(samples) / statistics.median(samples)
+
+
+def _format_table(header, rows):
+    widths = [max(len(str(x)) for x in column) for column in zip(header, *rows)]
+    lines = ['  '.join(str(x).ljust(w) for x, w in zip(row, widths)).rstrip() for row in [header] + rows]
+    lines.insert(1, '  '.join('-' * w for w in widths))
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--benchmark', required=True, help='path of the sorting_network_cpp_benchmark executable')
+    parser.add_argument('--baseline', default=os.path.join(dir_path, '..', 'doc', 'benchmark_timings.csv'),
+                        help='baseline table (default: doc/benchmark_timings.csv)')
+    parser.add_argument('--baseline-compiler',
+                        help='compiler column value of the baseline rows to compare against '
+                             '(default: the compiler reported by the benchmark)')
+    parser.add_argument('--runs', type=int, default=3, help='number of benchmark runs (default: 3)')
+    parser.add_argument('--tolerance', type=float, default=0.1,
+                        help='accepted relative slowdown, e.g. 0.1 for 10%% (default: 0.1)')
+    parser.add_argument('--noise-sigma', type=float, default=2.0,
+                        help='number of relative standard deviations of the runs added to the tolerance (default: 2)')
+    parser.add_argument('--write-baseline', action='store_true',
+                        help='write the median timings to the baseline file instead of comparing')
+    parser.add_argument('--all', action='store_true', help='list all compared measurements, not only regressions')
+    parser.add_argument('benchmark_args', nargs=argparse.REMAINDER,
+                        help='arguments passed to the benchmark after "--", e.g. -- --sizes=8,16 --mode=latency')
+    args = parser.parse_args()
+
+    benchmark_args = args.benchmark_args[1:] if args.benchmark_args[:1] == ['--'] else args.benchmark_args
+    current = _run_benchmark(args.benchmark, benchmark_args, max(args.runs, 1))
+
+    if args.write_baseline:
+        # rows of other compilers already present in the baseline are kept
+        compilers = set(compiler for compiler, _, _ in current)
+        table = {scenario: timings for scenario, timings in
+                 (_read_table(args.baseline) if os.path.exists(args.baseline) else {}).items()
+                 if scenario[0] not in compilers}
+        table.update({scenario: {a: statistics.median(t) for a, t in timings.items()}
+                      for scenario, timings in current.items()})
+
+        _write_table(args.baseline, table)
+        print(f'baseline written to {args.baseline}')
+        return 0
+
+    baseline_table = _read_table(args.baseline)
+    baseline_compiler = args.baseline_compiler or next(iter(current))[0]
+    baseline = {(data_type, n): timings for (compiler, data_type, n), timings in baseline_table.items()
+                if compiler == baseline_compiler}
+
+    rows = []
+    num_compared = 0
+    num_regressions = 0
+
+    for (_, data_type, n), timings in sorted(current.items()):
+        reference_timings = baseline.get((data_type, n), {})
+
+        for algorithm, samples in sorted(timings.items()):
+            if algorithm not in reference_timings:
+                continue
+
+            reference = reference_timings[algorithm]
+            median = statistics.median(samples)
+            change = median / reference - 1.0
+            noise = _relative_noise(samples)
+            is_regression = change > args.tolerance + args.noise_sigma * noise
+
+            num_compared += 1
+            num_regressions += is_regression
+
+            if is_regression or args.all:
+                rows.append([data_type, n, algorithm, f'{reference:.3f}', f'{median:.3f}',
+                             f'{change * 100.0:+.1f}%', f'{noise * 100.0:.1f}%',
+                             'REGRESSION' if is_regression else 'ok'])
+
+    if num_compared == 0:
+        print(f'no measurements of "{baseline_compiler}" in common with {args.baseline}; available compilers: '
+              f'{", ".join(sorted(set(c for c, _, _ in baseline_table)))}', file=sys.stderr)
+        return 1
+
+    if rows:
+        print(_format_table(['data type', 'N', 'algorithm', 'baseline (ms)', 'current (ms)', 'change', 'noise',
+                             'status'], rows))
+        print()
+
+    print(f'{num_regressions} regression(s) in {num_compared} compared measurement(s) '
+          f'(tolerance {args.tolerance * 100.0:.1f}% + {args.noise_sigma:g} sigma noise)')
+
+    return 1 if num_regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
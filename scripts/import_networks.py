@@ -0,0 +1,207 @@
+"""Imports sorting networks into sorting_network_cpp/networks/size_optimized_sort.h.
+
+The networks are read from text files in the format used by SorterHunter
+(https://github.com/bertdobbelaere/SorterHunter) and many other sources: a
+list of comparators (a,b) per layer, e.g.
+
+  [(0,2),(1,3)],[(0,1),(2,3)],[(1,2)]
+
+Layers may be separated by commas or line breaks; a single list of
+comparators is accepted as well. The number of values N of a network is the
+largest index + 1 (or is given by --size). Every network is verified with the
+0-1 principle (all 2^N inputs of zeros and ones are sorted bit parallel) and
+its comparators are scheduled into layers as early as possible.
+
+A network replaces the one for N in the header if it has fewer comparators
+(or as many comparators in fewer layers), unless --force is given; networks
+for the next size after the largest one in the header are appended. With
+--verify only the networks in the header are verified.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+header_path = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                           '../include/sorting_network_cpp/networks/size_optimized_sort.h')
+
+tuple_begin = '    using Networks = std::tuple<\n'
+tuple_end = '\n    >;\n'
+entry_indent = ' ' * 16
+layer_indent = ' ' * 26
+
+
+def _parse_network(text: str):
+    """Returns the comparators [(a, b), ...] of a network description."""
+    comparators = []
+
+    for a, b in re.findall(r'\(\s*(\d+)\s*,\s*(\d+)\s*\)', text):
+        a, b = int(a), int(b)
+
+        if a == b:
+            raise ValueError(f'comparator ({a},{b}) compares an index with itself')
+
+        comparators.append((min(a, b), max(a, b)))
+
+    return comparators
+
+
+def _layers(comparators, n: int):
+    """Schedules every comparator into the layer after the last one using one of its indices."""
+    depth = [0] * n
+    layers = []
+
+    for a, b in comparators:
+        layer = max(depth[a], depth[b])
+        depth[a] = depth[b] = layer + 1
+
+        if layer == len(layers):
+            layers.append([])
+
+        layers[layer].append((a, b))
+
+    return [sorted(layer) for layer in layers]
+
+
+def _sorts(comparators, n: int, chunk_bits: int = 20):
+    """Returns whether the network sorts all 2^n inputs of zeros and ones.
+
+    Index i < chunk_bits is represented by an integer whose bit k is the value
+    at index i of input k, so that a comparator is evaluated for 2^chunk_bits
+    inputs at once; the values at the indices above are enumerated."""
+    chunk_bits = min(n, chunk_bits)
+    all_ones = (1 << (1 << chunk_bits)) - 1
+    patterns = []
+
+    for i in range(chunk_bits):
+        # bit k of the pattern is bit i of k
+        pattern = ((1 << (1 << i)) - 1) << (1 << i)
+        period = 1 << (i + 1)
+
+        while period < 1 << chunk_bits:
+            pattern |= pattern << period
+            period <<= 1
+
+        patterns.append(pattern)
+
+    for high in range(1 << (n - chunk_bits)):
+        values = patterns + [all_ones if (high >> i) & 1 else 0 for i in range(n - chunk_bits)]
+
+        for a, b in comparators:
+            values[a], values[b] = values[a] & values[b], values[a] | values[b]
+
+        if any(values[i] & ~values[i + 1] for i in range(n - 1)):
+            return False
+
+    return True
+
+
+def _format_entry(n: int, layers):
+    """Returns the lines of the tuple element of the network of n values."""
+    if not layers:
+        layers = [[]]
+
+    lines = [layer_indent + 'L<' + ','.join(f'P<{a},{b}>' for a, b in layer) + '>,' for layer in layers]
+    lines[0] = (entry_indent + f'/* {n} */').ljust(len(layer_indent) - 1) + 'N<' + lines[0].lstrip()
+    lines[-1] = lines[-1][:-1] + '>'
+
+    return lines
+
+
+def _read_header(path: str):
+    """Returns the text of the header and the comparators of its networks {n: [(a, b), ...]}."""
+    text = open(path, encoding='utf8').read()
+    begin = text.index(tuple_begin) + len(tuple_begin)
+    end = text.index(tuple_end, begin)
+
+    networks = {}
+
+    for n, entry in re.findall(r'/\* (\d+) \*/(.*?)(?=/\* \d+ \*/|$)', text[begin:end], re.DOTALL):
+        networks[int(n)] = [(int(a), int(b)) for a, b in re.findall(r'P<(\d+),(\d+)>', entry)]
+
+    return text, networks
+
+
+def _write_header(path: str, text: str, networks):
+    begin = text.index(tuple_begin) + len(tuple_begin)
+    end = text.index(tuple_end, begin)
+
+    lines = []
+
+    for i, n in enumerate(sorted(networks)):
+        entry = _format_entry(n, _layers(networks[n], n))
+
+        if i + 1 < len(networks):
+            entry[-1] += ','
+
+        lines += entry
+
+    open(path, 'w', encoding='utf8').write(text[:begin] + '\n'.join(lines) + text[end:])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('networks', nargs='*', help='text files containing one network each')
+    parser.add_argument('--size', type=int, help='number of values of the imported networks (default: largest '
+                                                 'index + 1)')
+    parser.add_argument('--force', action='store_true', help='replace networks even if they are not smaller')
+    parser.add_argument('--verify', action='store_true', help='only verify the networks in the header')
+    parser.add_argument('--header', default=header_path, help='header to update (default: %(default)s)')
+    args = parser.parse_args()
+
+    text, networks = _read_header(args.header)
+
+    if args.verify:
+        invalid = [n for n, comparators in sorted(networks.items()) if not _sorts(comparators, n)]
+
+        for n in invalid:
+            print(f'the network for {n} values does not sort', file=sys.stderr)
+
+        print(f'verified {len(networks) - len(invalid)} of {len(networks)} networks')
+        return 1 if invalid else 0
+
+    if not args.networks:
+        parser.error('no networks given')
+
+    changed = False
+
+    for path in args.networks:
+        comparators = _parse_network(open(path, encoding='utf8').read())
+        n = args.size or (max(max(c) for c in comparators) + 1 if comparators else 1)
+
+        if any(b >= n for _, b in comparators):
+            print(f'{path}: comparator index exceeds {n} values', file=sys.stderr)
+            return 1
+
+        if not _sorts(comparators, n):
+            print(f'{path}: the network does not sort {n} values', file=sys.stderr)
+            return 1
+
+        depth = len(_layers(comparators, n))
+        print(f'{path}: {n} values, {len(comparators)} comparators, {depth} layers')
+
+        if n in networks:
+            current = (len(networks[n]), len(_layers(networks[n], n)))
+
+            if not args.force and (len(comparators), depth) >= current:
+                print(f'  not imported, the network in the header has {current[0]} comparators and '
+                      f'{current[1]} layers')
+                continue
+        elif n != max(networks) + 1:
+            print(f'{path}: networks are stored for consecutive sizes, the next size is {max(networks) + 1}',
+                  file=sys.stderr)
+            return 1
+
+        networks[n] = comparators
+        changed = True
+
+    if changed:
+        _write_header(args.header, text, networks)
+        print(f'updated {args.header}')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,220 @@
+"""Measures compile time, object size and instruction count of sorting network instantiations.
+
+For every network type (as listed in include/sorting_network_cpp/networks/common.h),
+data type and problem size N a translation unit containing a single function
+sorting an array with sorting_network<N, type> is compiled. The results are
+written as tab separated tables in the format of the runtime benchmark
+(doc/benchmark_timings.csv), one file per metric:
+
+  compile_times.csv       median compile time in ms; the column "header only" holds
+                          the compile time of a translation unit which only includes
+                          the library without instantiating a network
+  object_sizes.csv        size of the object file in bytes
+  code_sizes.csv          size of the code (.text) sections in bytes (requires objdump)
+  instruction_counts.csv  number of instructions in the object file (requires objdump)
+"""
+
+import argparse
+import os
+import re
+import shlex
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+dir_path = os.path.dirname(os.path.realpath(__file__))
+include_dir_path = os.path.join(dir_path, '..', 'include')
+
+value_types = {
+    'int16_t': 'std::int16_t',
+    'int32_t': 'std::int32_t',
+    'uint32_t': 'std::uint32_t',
+    'int64_t': 'std::int64_t',
+    'float': 'float',
+    'double': 'double',
+}
+
+compiler_id_source = '''#if defined(_MSC_VER)
+msvc _MSC_VER
+#elif defined(__clang__)
+clang __clang_major__.__clang_minor__.__clang_patchlevel__
+#elif defined(__GNUC__)
+gcc __GNUC__.__GNUC_MINOR__
+#else
+unknown compiler
+#endif
+'''
+
+
+def _network_types():
+    common_h = open(os.path.join(include_dir_path, 'sorting_network_cpp', 'networks', 'common.h'), 'r',
+                    encoding='utf8').read()
+    enum_body = re.search(r'enum class type\s*\{([^}]*)\}', common_h).group(1)
+    return [x.split('=')[0].strip() for x in enum_body.split(',') if x.strip()]
+
+
+class _Compiler:
+    def __init__(self, executable: str, flags, tmp_dir: str):
+        self.executable = executable
+        self.tmp_dir = tmp_dir
+
+        source_path = os.path.join(tmp_dir, 'compiler_id.cpp')
+        open(source_path, 'w', encoding='utf8').write(compiler_id_source)
+        self.is_msvc = os.path.splitext(os.path.basename(executable))[0].lower() in ('cl', 'clang-cl')
+
+        preprocessed = subprocess.run([executable] + (['/nologo', '/EP'] if self.is_msvc else ['-E', '-P']) +
+                                      [source_path], check=True, capture_output=True, text=True).stdout
+        name, version = next(x for x in preprocessed.splitlines() if x.strip()).strip().split(' ', 1)
+        self.id = name + ' ' + ''.join(version.split())
+
+        if flags is None:
+            flags = ['/O2', '/fp:fast'] if self.is_msvc else ['-O3', '-ffast-math']
+
+        if self.is_msvc:
+            self.flags = ['/nologo', '/c', '/std:c++17', '/EHsc', f'/I{include_dir_path}'] + flags
+        else:
+            self.flags = ['-c', '-std=c++17', f'-I{include_dir_path}'] + flags
+
+    def compile(self, source: str):
+        """Compiles source and returns (compile time in ms, object file path) or None on failure."""
+        source_path = os.path.join(self.tmp_dir, 'tu.cpp')
+        object_path = os.path.join(self.tmp_dir, 'tu.obj' if self.is_msvc else 'tu.o')
+        open(source_path, 'w', encoding='utf8').write(source)
+
+        if os.path.exists(object_path):
+            os.remove(object_path)
+
+        output_flag = [f'/Fo{object_path}'] if self.is_msvc else ['-o', object_path]
+
+        start = time.perf_counter()
+        result = subprocess.run([self.executable] + self.flags + output_flag + [source_path], capture_output=True)
+        end = time.perf_counter()
+
+        if result.returncode != 0:
+            return None
+
+        return (end - start) * 1000.0, object_path
+
+
+def _make_source(value_type: str, n: int, network_type: str):
+    source = '#include <sorting_network_cpp/sorting_network.h>\n\n#include <cstdint>\n'
+
+    if network_type is None:
+        return source
+
+    return source + f'''
+using quxflux::sorting_net::type;
+
+static_assert(quxflux::sorting_net::available_v<{n}, type::{network_type}>);
+
+void sort({value_type}* data)
+{{
+  quxflux::sorting_net::sorting_network<{n}, type::{network_type}>{{}}(data);
+}}
+'''
+
+
+def _disassembly_metrics(objdump: str, object_path: str):
+    """Returns (size of the code sections, number of instructions) of the object file."""
+    headers = subprocess.run([objdump, '-h', object_path], check=True, capture_output=True, text=True).stdout
+    code_size = sum(int(m.group(1), 16) for m in re.finditer(r'^\s*\d+\s+\.text\S*\s+([0-9a-fA-F]+)', headers, re.M))
+
+    disassembly = subprocess.run([objdump, '-d', '--no-show-raw-insn', object_path], check=True, capture_output=True,
+                                 text=True).stdout
+    num_instructions = len(re.findall(r'^\s*[0-9a-f]+:\s+\S', disassembly, re.M))
+
+    return code_size, num_instructions
+
+
+def _write_table(path: str, compiler_id: str, table):
+    # same column order as the runtime benchmark, the header only compile time first
+    columns = sorted(set(x for values in table.values() for x in values), key=lambda x: (x != 'header only', x))
+
+    with open(path, 'w', encoding='utf8') as f:
+        f.write('\t'.join(['compiler', 'data type', 'N'] + columns) + '\t\n')
+
+        for (data_type, n), values in sorted(table.items()):
+            cells = [compiler_id, data_type, str(n)] + [f'{values[x]:g}' if values.get(x) is not None else ' '
+                                                        for x in columns]
+            f.write('\t'.join(cells) + '\t\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'), help='C++ compiler (default: $CXX or c++)')
+    parser.add_argument('--flags', help='optimization flags (default: -O3 -ffast-math or /O2 /fp:fast for msvc)')
+    parser.add_argument('--objdump', default=shutil.which('objdump'), help='objdump executable (default: from PATH)')
+    parser.add_argument('--data-types', default='float', help='comma separated list of data types (default: float)')
+    parser.add_argument('--sizes', default='1,2,4,8,16,24,32,48,64,128', help='comma separated list of problem sizes')
+    parser.add_argument('--repeat', type=int, default=3, help='compilations per measurement (default: 3)')
+    parser.add_argument('--output-dir', default='.', help='directory the tables are written to')
+    args = parser.parse_args()
+
+    data_types = args.data_types.split(',')
+    sizes = [int(x) for x in args.sizes.split(',')]
+    network_types = _network_types()
+
+    for data_type in data_types:
+        if data_type not in value_types:
+            parser.error(f'unknown data type {data_type}, available: {", ".join(value_types)}')
+
+    compile_times = {}
+    object_sizes = {}
+    code_sizes = {}
+    instruction_counts = {}
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        compiler = _Compiler(args.compiler, shlex.split(args.flags) if args.flags is not None else None, tmp_dir)
+
+        header_only_time = statistics.median(compiler.compile(_make_source('', 0, None))[0]
+                                             for _ in range(max(args.repeat, 1)))
+
+        for data_type in data_types:
+            for n in sizes:
+                scenario = (data_type, n)
+                compile_times[scenario] = {'header only': header_only_time}
+
+                for network_type in network_types:
+                    print(f'{data_type}, {n} item(s), {network_type}', file=sys.stderr)
+
+                    column = f'SN::{network_type}'
+                    source = _make_source(value_types[data_type], n, network_type)
+                    times = []
+                    result = None
+
+                    for _ in range(max(args.repeat, 1)):
+                        result = compiler.compile(source)
+                        if result is None:
+                            break
+                        times.append(result[0])
+
+                    if result is None:
+                        for table in (compile_times, object_sizes, code_sizes, instruction_counts):
+                            table.setdefault(scenario, {})[column] = None
+                        continue
+
+                    compile_times[scenario][column] = statistics.median(times)
+                    object_sizes.setdefault(scenario, {})[column] = os.path.getsize(result[1])
+
+                    if args.objdump:
+                        code_size, num_instructions = _disassembly_metrics(args.objdump, result[1])
+                        code_sizes.setdefault(scenario, {})[column] = code_size
+                        instruction_counts.setdefault(scenario, {})[column] = num_instructions
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    _write_table(os.path.join(args.output_dir, 'compile_times.csv'), compiler.id, compile_times)
+    _write_table(os.path.join(args.output_dir, 'object_sizes.csv'), compiler.id, object_sizes)
+
+    if args.objdump:
+        _write_table(os.path.join(args.output_dir, 'code_sizes.csv'), compiler.id, code_sizes)
+        _write_table(os.path.join(args.output_dir, 'instruction_counts.csv'), compiler.id, instruction_counts)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
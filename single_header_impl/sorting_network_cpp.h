@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace quxflux::sorting_net
 {
@@ -36,17 +40,44 @@ namespace quxflux::sorting_net
     bose_nelson_sort,
     batcher_odd_even_merge_sort,
     bitonic_merge_sort,
-    size_optimized_sort
+    size_optimized_sort,
+    rank_sort,
+    odd_even_transposition_sort,
+    pairwise_sort,
+    auto_select
   };
 
+  // Compare and swap operation which evaluates the predicate once and swaps
+  // the values only if they are out of order; avoids the copies of
+  // compare_and_swap for types which are expensive to copy (e.g. std::string)
+  template<typename T, typename Predicate>
+  struct move_compare_and_swap
+  {
+    constexpr void operator()(T& a, T& b) const noexcept
+    {
+      using std::swap;
+
+      if (Predicate{}(b, a))
+        swap(a, b);
+    }
+  };
+
+  // Branchless compare and swap operation for trivially copyable types; other
+  // types are handled by move_compare_and_swap
   template<typename T, typename Predicate>
   struct compare_and_swap
   {
     constexpr void operator()(T& a, T& b) const noexcept
     {
-      const T t = Predicate{}(a, b) ? a : b;
-      b = Predicate{}(a, b) ? b : a;
-      a = t;
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        const T t = Predicate{}(a, b) ? a : b;
+        b = Predicate{}(a, b) ? b : a;
+        a = t;
+      } else
+      {
+        move_compare_and_swap<T, Predicate>{}(a, b);
+      }
     }
   };
 
@@ -55,9 +86,17 @@ namespace quxflux::sorting_net
     template<typename It, typename CAS>
     struct iterator_compare_and_swap;
 
+    template<typename It, typename = void>
+    struct is_random_access_iterator : std::false_type
+    {};
+
+    template<typename It>
+    struct is_random_access_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+      : std::is_same<typename std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>
+    {};
+
     template<typename It>
-    static inline constexpr bool is_random_access_iterator_v =
-      std::is_same_v<typename std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>;
+    static inline constexpr bool is_random_access_iterator_v = is_random_access_iterator<It>::value;
   }  // namespace detail
 
   template<std::size_t A, std::size_t B>
@@ -116,6 +155,22 @@ namespace quxflux::sorting_net
       return result >>= 1;
     }
 
+    constexpr std::size_t next_power_of_two(const std::size_t n)
+    {
+      std::size_t result = 1;
+
+      while (result < n)
+        result <<= 1;
+
+      return result;
+    }
+
+    // Smallest unsigned type which can represent the indices 0 ... N - 1
+    template<std::size_t N>
+    using index_type_t = std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max() + 1_z), std::uint8_t,
+                                            std::conditional_t<(N <= std::numeric_limits<std::uint16_t>::max() + 1_z),
+                                                               std::uint16_t, std::size_t>>;
+
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
     constexpr T int_div_ceil(const T x, const T y)
     {
@@ -124,6 +179,114 @@ namespace quxflux::sorting_net
 
     template<std::size_t N, type NWT, typename = void>
     struct sorting_network;
+
+    // The network type actually used to sort N values of type T when
+    // NetworkType is requested; specialized for type::auto_select
+    template<typename T, std::size_t N, type NetworkType>
+    struct resolve_network_type : std::integral_constant<type, NetworkType>
+    {};
+
+    // Runtime representation of a cas_node
+    struct comparator
+    {
+      std::size_t a = 0;
+      std::size_t b = 0;
+    };
+
+    template<std::size_t A, std::size_t B>
+    constexpr std::size_t num_comparators(const cas_node<A, B>)
+    {
+      return 1_z;
+    }
+
+    template<typename... LayerOrCas>
+    constexpr std::size_t num_comparators(const layer<LayerOrCas...>)
+    {
+      return (0_z + ... + num_comparators(LayerOrCas{}));
+    }
+
+    template<typename... Layers>
+    constexpr std::size_t num_comparators(const net<Layers...>)
+    {
+      return (0_z + ... + num_comparators(Layers{}));
+    }
+
+    template<std::size_t Size, std::size_t A, std::size_t B>
+    constexpr std::size_t flatten(const cas_node<A, B>, std::array<comparator, Size>& out, const std::size_t i)
+    {
+      out[i] = comparator{A, B};
+      return i + 1_z;
+    }
+
+    template<std::size_t Size, typename... LayerOrCas>
+    constexpr std::size_t flatten(const layer<LayerOrCas...>, std::array<comparator, Size>& out, std::size_t i)
+    {
+      ((i = flatten(LayerOrCas{}, out, i)), ...);
+      return i;
+    }
+
+    template<std::size_t Size, typename... Layers>
+    constexpr std::size_t flatten(const net<Layers...>, std::array<comparator, Size>& out, std::size_t i)
+    {
+      ((i = flatten(Layers{}, out, i)), ...);
+      return i;
+    }
+
+    // Flattened representation of a network: the comparators in order of
+    // execution and the index of the layer each comparator belongs to when the
+    // comparators are scheduled as early as possible
+    template<typename Network>
+    struct flattened_network
+    {
+    private:
+      static constexpr std::array<comparator, num_comparators(Network{})> make_comparators()
+      {
+        std::array<comparator, num_comparators(Network{})> result{};
+        flatten(Network{}, result, 0_z);
+        return result;
+      }
+
+      static constexpr std::size_t num_channels()
+      {
+        std::size_t result = 0;
+
+        for (const auto& c : comparators)
+          result = std::max({result, c.a + 1_z, c.b + 1_z});
+
+        return result;
+      }
+
+      static constexpr std::array<std::size_t, num_comparators(Network{})> make_layers()
+      {
+        std::array<std::size_t, num_comparators(Network{})> result{};
+        std::array<std::size_t, num_channels()> channel_depth{};
+
+        for (std::size_t i = 0; i < comparators.size(); ++i)
+        {
+          const auto [a, b] = comparators[i];
+
+          result[i] = std::max(channel_depth[a], channel_depth[b]);
+          channel_depth[a] = channel_depth[b] = result[i] + 1_z;
+        }
+
+        return result;
+      }
+
+      static constexpr std::size_t make_depth()
+      {
+        std::size_t result = 0;
+
+        for (const auto layer : layers)
+          result = std::max(result, layer + 1_z);
+
+        return result;
+      }
+
+    public:
+      static constexpr std::array<comparator, num_comparators(Network{})> comparators = make_comparators();
+      static constexpr std::array<std::size_t, num_comparators(Network{})> layers = make_layers();
+      static constexpr std::size_t depth = make_depth();
+    };
   }  // namespace detail
 
   template<std::size_t N, type Network, typename = void>
@@ -137,7 +300,154 @@ namespace quxflux::sorting_net
   template<std::size_t N, type Network>
   constexpr bool available_v = available<N, Network>::value;
 
-  template<std::size_t N, type NetworkType = type::bose_nelson_sort>
+  // Execution policies which can be passed as first argument to
+  // sorting_network::operator() to select how the comparators access the values
+  namespace execution
+  {
+    // Every comparator accesses the values through the iterator
+    struct in_place_policy
+    {};
+
+    // The values are loaded into a local array, the comparators are executed
+    // on it and the values are stored back once; since the local array can not
+    // alias any other memory, the compiler is free to keep the values in
+    // registers. Requires a trivially copyable value type.
+    struct registers_policy
+    {};
+
+    // registers_policy for contiguous iterators (pointers, iterators of
+    // std::vector or, when compiled as C++20, every std::contiguous_iterator)
+    // over trivially copyable values, in_place_policy otherwise
+    struct automatic_policy
+    {};
+
+    // The comparators are stored as a table of index pairs (one byte per index
+    // for up to 256 values) and executed through the iterator in a loop instead
+    // of being unrolled. The generated code is of constant size, which reduces
+    // the instruction cache pressure of large networks (or of many instantiated
+    // networks) at the cost of loading the indices and the loop overhead.
+    struct compact_policy
+    {};
+
+    static inline constexpr in_place_policy in_place{};
+    static inline constexpr registers_policy registers{};
+    static inline constexpr automatic_policy automatic{};
+    static inline constexpr compact_policy compact{};
+
+    template<typename T>
+    static inline constexpr bool is_execution_policy_v =
+      std::is_same_v<T, in_place_policy> || std::is_same_v<T, registers_policy> ||
+      std::is_same_v<T, automatic_policy> || std::is_same_v<T, compact_policy>;
+  }  // namespace execution
+
+  namespace detail
+  {
+    template<typename It, typename T = typename std::iterator_traits<It>::value_type>
+    static inline constexpr bool is_contiguous_iterator_v =
+#if defined(__cpp_lib_concepts)
+      std::contiguous_iterator<It> ||
+#endif
+      std::is_pointer_v<It> || (!std::is_same_v<T, bool> && std::is_same_v<It, typename std::vector<T>::iterator>);
+
+    template<typename It, typename CAS, typename Network, std::size_t... Is>
+    constexpr void apply_in_registers(const It begin, const CAS& cas, const Network network,
+                                      std::index_sequence<Is...>) noexcept
+    {
+      std::array<typename std::iterator_traits<It>::value_type, sizeof...(Is)> values{begin[Is]...};
+
+      apply(values.data(), cas, network);
+
+      ((begin[Is] = values[Is]), ...);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::in_place_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      apply(begin, cas, network);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::registers_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      static_assert(std::is_trivially_copyable_v<typename std::iterator_traits<It>::value_type>,
+                    "execution::registers requires a trivially copyable value type");
+
+      apply_in_registers(begin, cas, network, std::make_index_sequence<N>{});
+    }
+
+    // The comparators of Network as pairs of the smallest index type
+    template<std::size_t N, typename Network>
+    struct compact_network
+    {
+    private:
+      using index_pair = std::array<index_type_t<N>, 2>;
+      using flattened = flattened_network<Network>;
+
+      static constexpr std::array<index_pair, flattened::comparators.size()> make_comparators()
+      {
+        std::array<index_pair, flattened::comparators.size()> result{};
+
+        for (std::size_t i = 0; i < result.size(); ++i)
+          result[i] = {static_cast<index_type_t<N>>(flattened::comparators[i].a),
+                       static_cast<index_type_t<N>>(flattened::comparators[i].b)};
+
+        return result;
+      }
+
+    public:
+      static constexpr std::array<index_pair, flattened::comparators.size()> comparators = make_comparators();
+    };
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::compact_policy, const It begin, const CAS& cas, const Network) noexcept
+    {
+      for (const auto& [a, b] : compact_network<N, Network>::comparators)
+        iterator_compare_and_swap<It, CAS>()(begin + a, begin + b, cas);
+    }
+
+    template<std::size_t N, typename It, typename CAS, typename Network>
+    constexpr void execute(execution::automatic_policy, const It begin, const CAS& cas, const Network network) noexcept
+    {
+      if constexpr (is_contiguous_iterator_v<It> &&
+                    std::is_trivially_copyable_v<typename std::iterator_traits<It>::value_type>)
+        execute<N>(execution::registers, begin, cas, network);
+      else
+        execute<N>(execution::in_place, begin, cas, network);
+    }
+
+    // Sorts N values by executing the comparators of the network of
+    // NetworkType; specialized for network types which sort differently
+    template<std::size_t N, type NetworkType>
+    struct sorter
+    {
+      template<typename ExecutionPolicy, typename It, typename CAS>
+      static constexpr void sort(const ExecutionPolicy policy, const It begin, const CAS& cas) noexcept
+      {
+        execute<N>(policy, begin, cas, typename sorting_network<N, NetworkType>::type{});
+      }
+    };
+  }  // namespace detail
+
+  // Describes inputs which begin with runs of values which are in order
+  // already: the first RunLengths[0] values are sorted, the next RunLengths[1]
+  // values are sorted and so on; the values after the runs are in arbitrary
+  // order. presorted_runs<> describes inputs in arbitrary order.
+  template<std::size_t... RunLengths>
+  struct presorted_runs
+  {};
+
+  namespace detail
+  {
+    // Network without the comparators which never swap values of inputs
+    // described by Presorted (defined in networks/presorted_runs.h)
+    template<std::size_t N, typename Network, typename Presorted>
+    struct prune_presorted;
+  }  // namespace detail
+
+  // Sorts N values with the network of NetworkType. If the input is known to
+  // consist of presorted runs (see presorted_runs), the comparators which never
+  // swap values of such inputs are removed at compile time.
+  template<std::size_t N, type NetworkType = type::bose_nelson_sort, typename Presorted = presorted_runs<>>
   struct sorting_network
   {
     static_assert(N > 0);
@@ -148,63 +458,158 @@ namespace quxflux::sorting_net
              typename = std::enable_if_t<detail::is_random_access_iterator_v<It>>>
     constexpr void operator()(const It begin, const CompareAndSwap& cas = {}) const noexcept
     {
-      if constexpr (N > 1)
-        apply(begin, cas, typename detail::sorting_network<N, NetworkType>::type{});
+      (*this)(execution::automatic, begin, cas);
+    }
+
+    template<typename ExecutionPolicy, typename It,
+             typename CompareAndSwap = compare_and_swap<typename std::iterator_traits<It>::value_type,
+                                                        std::less<typename std::iterator_traits<It>::value_type>>,
+             typename = std::enable_if_t<execution::is_execution_policy_v<ExecutionPolicy> &&
+                                         detail::is_random_access_iterator_v<It>>>
+    constexpr void operator()(const ExecutionPolicy policy, const It begin,
+                              const CompareAndSwap& cas = {}) const noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+      constexpr type network_type = detail::resolve_network_type<value_type, N, NetworkType>::value;
+
+      if constexpr (N > 1 && std::is_same_v<Presorted, presorted_runs<>>)
+      {
+        detail::sorter<N, network_type>::sort(policy, begin, cas);
+      } else if constexpr (N > 1)
+      {
+        using network = typename detail::sorting_network<N, network_type>::type;
+        detail::execute<N>(policy, begin, cas, typename detail::prune_presorted<N, network, Presorted>::type{});
+      }
     }
   };
 }  // namespace quxflux::sorting_net
 
 namespace quxflux::sorting_net::detail
 {
-  // Generates a sorting network based the construction scheme
-  // by Ken Batcher
+  // Network types in order of preference for sorting n values of type T.
+  // The default prefers type::bose_nelson_sort for every type and n; tables
+  // generated by scripts/autotune.py specialize this template for the
+  // benchmarked value types.
+  template<typename T, typename = void>
+  struct auto_select_table
+  {
+    static constexpr std::array<type, 1> candidates(const std::size_t) { return {type::bose_nelson_sort}; }
+  };
+
+  // The network of type::auto_select independent of the value type (e.g. for
+  // available_v); the network actually used is chosen by resolve_network_type
   template<std::size_t N>
-  struct sorting_network<N, type::batcher_odd_even_merge_sort, std::enable_if_t<is_power_of_two(N)>>
+  struct sorting_network<N, type::auto_select> : sorting_network<N, type::bose_nelson_sort>
+  {};
+
+  template<typename T, std::size_t N>
+  struct resolve_network_type<T, N, type::auto_select>
   {
   private:
-    template<std::size_t I, std::size_t J, std::size_t R, typename = void>
-    struct gen_merge
+    template<std::size_t... Is>
+    static constexpr bool is_available(const type t, std::index_sequence<Is...>)
     {
-      using type = sorting_net::layer<sorting_net::cas_node<I, (I + R)>>;
-    };
+      return ((t == static_cast<type>(Is) && available_v<N, static_cast<type>(Is)>) || ...);
+    }
+
+    static constexpr type select()
+    {
+      for (const type t : auto_select_table<T>::candidates(N))
+        if (is_available(t, std::make_index_sequence<static_cast<std::size_t>(type::auto_select)>{}))
+          return t;
+
+      return type::bose_nelson_sort;
+    }
+
+  public:
+    static constexpr type value = select();
+  };
+}  // namespace quxflux::sorting_net::detail
+
+#if defined(SORTING_NETWORK_CPP_AUTO_SELECT_TABLE)
+#include SORTING_NETWORK_CPP_AUTO_SELECT_TABLE
+#endif
+
+namespace quxflux::sorting_net::detail
+{
+  // Generates a sorting network based the construction scheme by Ken Batcher
+  // in the merge exchange formulation for arbitrary N (Knuth, TAOCP Vol. 3,
+  // 5.2.2, Algorithm M): with 2^t >= N, the network consists of the passes
+  // p = 2^(t - 1), ..., 2, 1, each of which orders the subsequences of the
+  // indices with equal bits below p by comparing index i to i + d for all i
+  // whose bit p equals r in layers (d = p, r = 0) and (d = q - p, r = p) for
+  // q = 2^(t - 1), ..., 2 * p. Comparators beyond the last index are omitted.
+  template<std::size_t N>
+  struct sorting_network<N, type::batcher_odd_even_merge_sort>
+  {
+  private:
+    static constexpr std::size_t Top = next_power_of_two(N) / 2_z;
 
-    template<std::size_t I, std::size_t J, std::size_t R>
-    struct gen_merge<I, J, R, std::enable_if_t<(R * 2_z <= J - I)>>
+    // The k-th index i < N - D with (i & P) == R
+    template<std::size_t P, std::size_t D, std::size_t R>
+    static constexpr std::size_t nth_index(std::size_t k)
     {
-      static constexpr std::size_t step = R * 2_z;
+      std::size_t i = 0;
+
+      for (; i + D < N; ++i)
+        if ((i & P) == R && k-- == 0_z)
+          break;
 
+      return i;
+    }
+
+    template<std::size_t P, std::size_t D, std::size_t R>
+    static constexpr std::size_t num_indices()
+    {
+      std::size_t result = 0;
+
+      for (std::size_t i = 0; i + D < N; ++i)
+        result += (i & P) == R ? 1_z : 0_z;
+
+      return result;
+    }
+
+    template<std::size_t P, std::size_t D, std::size_t R>
+    struct gen_exchange
+    {
       template<std::size_t... Indices>
       static auto gen_cas(std::index_sequence<Indices...>)
-        -> sorting_net::layer<sorting_net::cas_node<I + R + Indices * step, I + R + Indices * step + R>...>
+        -> sorting_net::layer<sorting_net::cas_node<nth_index<P, D, R>(Indices), nth_index<P, D, R>(Indices) + D>...>
       {
         return {};
       }
 
-      using type =
-        sorting_net::layer<typename gen_merge<I, J, step>::type, typename gen_merge<I + R, J, step>::type,
-                           decltype(gen_cas(std::make_index_sequence<int_div_ceil((J - R) - (I + R), step)>()))>;
+      using type = decltype(gen_cas(std::make_index_sequence<num_indices<P, D, R>()>()));
     };
 
-    template<std::size_t Lo, std::size_t Hi, typename = void>
-    struct gen_sort
+    template<std::size_t P, std::size_t Q, typename = void>
+    struct gen_exchanges
     {
       using type = sorting_net::layer<>;
     };
 
-    template<std::size_t Lo, std::size_t Hi>
-    struct gen_sort<Lo, Hi, std::enable_if_t<(Hi - Lo >= 1_z)>>
+    template<std::size_t P, std::size_t Q>
+    struct gen_exchanges<P, Q, std::enable_if_t<(Q > P)>>
     {
-      static constexpr std::size_t Mid = Lo + (Hi - Lo) / 2_z;
+      using type =
+        sorting_net::layer<typename gen_exchange<P, Q - P, P>::type, typename gen_exchanges<P, Q / 2_z>::type>;
+    };
 
-      using type = sorting_net::layer<           //
-        typename gen_sort<Lo, Mid>::type,        //
-        typename gen_sort<Mid + 1_z, Hi>::type,  //
-        typename gen_merge<Lo, Hi, 1_z>::type    //
-        >;
+    template<std::size_t P, typename = void>
+    struct gen_pass
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t P>
+    struct gen_pass<P, std::enable_if_t<(P > 0_z)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<P, P, 0_z>::type, typename gen_exchanges<P, Top>::type,
+                                      typename gen_pass<P / 2_z>::type>;
     };
 
   public:
-    using type = sorting_net::net<typename gen_sort<0_z, N - 1_z>::type>;
+    using type = sorting_net::net<typename gen_pass<Top>::type>;
   };
 }  // namespace quxflux::sorting_net
 
@@ -422,6 +827,357 @@ namespace quxflux::sorting_net::detail
   };
 }  // namespace quxflux::sorting_net::detail
 
+namespace quxflux::sorting_net::detail
+{
+  // Generates an odd-even transposition sort sorting network of following form
+  // (0,1) (2,3) (4,5) ...
+  // (1,2) (3,4) (5,6) ...
+  // ...
+  // with N layers alternating between the even and the odd neighbours; it
+  // consists of as many comparators as the bubble sort network, but every
+  // layer compares all neighbours of the same parity at once
+  template<std::size_t N>
+  struct sorting_network<N, type::odd_even_transposition_sort, void>
+  {
+  private:
+    template<std::size_t Parity, std::size_t... PairIndices>
+    static auto gen_layer_pairs(const std::index_sequence<PairIndices...>)
+      -> sorting_net::layer<sorting_net::cas_node<Parity + 2_z * PairIndices, Parity + 2_z * PairIndices + 1_z>...>
+    {
+      return {};
+    }
+
+    template<std::size_t... LayerIndices>
+    static auto gen_layers(const std::index_sequence<LayerIndices...>) -> sorting_net::net<decltype(
+      gen_layer_pairs<LayerIndices % 2_z>(std::make_index_sequence<(N - LayerIndices % 2_z) / 2_z>()))...>
+    {
+      return {};
+    };
+
+  public:
+    using type = decltype(gen_layers(std::make_index_sequence<N>()));
+  };
+}  // namespace quxflux::sorting_net::detail
+
+namespace quxflux::sorting_net::detail
+{
+  // Generates the pairwise sorting network by Ian Parberry for arbitrary N:
+  // the values are first sorted in pairs of growing distance a = 1, 2, 4, ...
+  // (index i compared to i + a for all i with (i & a) == 0), afterwards the
+  // pairs are merged by comparing index i + d * a to i + (d + 1) * a for
+  // a = 2^(t - 2), ..., 2, 1 (2^t >= N) and d = e, e / 2, ..., 1 with
+  // e = 2^(t - 2) / a * 2 - 1. The network has as many comparators and layers
+  // as batcher_odd_even_merge_sort for powers of two, but the comparators of a
+  // layer are all of the same distance. Comparators beyond the last index are
+  // omitted.
+  template<std::size_t N>
+  struct sorting_network<N, type::pairwise_sort>
+  {
+  private:
+    // The k-th index i >= Start which lies in the first half of a block of
+    // size 2 * A relative to Start
+    template<std::size_t Start, std::size_t A>
+    static constexpr std::size_t nth_index(const std::size_t k)
+    {
+      return Start + k / A * 2_z * A + k % A;
+    }
+
+    template<std::size_t Start, std::size_t A>
+    static constexpr std::size_t num_indices()
+    {
+      std::size_t result = 0;
+
+      while (nth_index<Start, A>(result) < N)
+        ++result;
+
+      return result;
+    }
+
+    // Compares every index i above to i - Distance
+    template<std::size_t Start, std::size_t A, std::size_t Distance>
+    struct gen_exchange
+    {
+      template<std::size_t... Indices>
+      static auto gen_cas(std::index_sequence<Indices...>) -> sorting_net::layer<
+        sorting_net::cas_node<nth_index<Start, A>(Indices) - Distance, nth_index<Start, A>(Indices)>...>
+      {
+        return {};
+      }
+
+      using type = decltype(gen_cas(std::make_index_sequence<num_indices<Start, A>()>()));
+    };
+
+    template<std::size_t A, typename = void>
+    struct gen_pairs
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A>
+    struct gen_pairs<A, std::enable_if_t<(A < N)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<A, A, A>::type, typename gen_pairs<A * 2_z>::type>;
+    };
+
+    template<std::size_t A, std::size_t D, typename = void>
+    struct gen_merge_layers
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A, std::size_t D>
+    struct gen_merge_layers<A, D, std::enable_if_t<(D > 0_z)>>
+    {
+      using type = sorting_net::layer<typename gen_exchange<(D + 1_z) * A, A, D * A>::type,
+                                      typename gen_merge_layers<A, D / 2_z>::type>;
+    };
+
+    template<std::size_t A, std::size_t E, typename = void>
+    struct gen_merge
+    {
+      using type = sorting_net::layer<>;
+    };
+
+    template<std::size_t A, std::size_t E>
+    struct gen_merge<A, E, std::enable_if_t<(A > 0_z)>>
+    {
+      using type =
+        sorting_net::layer<typename gen_merge_layers<A, E>::type, typename gen_merge<A / 2_z, E * 2_z + 1_z>::type>;
+    };
+
+  public:
+    using type = sorting_net::net<typename gen_pairs<1_z>::type,
+                                  typename gen_merge<next_power_of_two(N) / 4_z, 1_z>::type>;
+  };
+}  // namespace quxflux::sorting_net::detail
+
+namespace quxflux::sorting_net::detail
+{
+  // The largest number of groups of up to 64 inputs of zeros and ones which
+  // are evaluated to prune a network for presorted runs
+  static inline constexpr std::size_t max_presorted_input_groups = 1_z << 9;
+
+  // Removes the comparators of Network which never swap values if the input
+  // consists of the presorted runs RunLengths followed by values in arbitrary
+  // order. A run of L sorted zeros and ones is one of L + 1 sequences (zeros
+  // followed by ones), every other value is either zero or one. All inputs of
+  // zeros and ones which adhere to the runs are evaluated, 64 inputs at once.
+  // By the 0-1 principle, a comparator which swaps no values of those inputs
+  // does not swap values of any input which adheres to the runs.
+  template<std::size_t N, typename Network, std::size_t... RunLengths>
+  struct prune_presorted<N, Network, presorted_runs<RunLengths...>>
+  {
+  private:
+    static constexpr std::array<std::size_t, sizeof...(RunLengths)> run_lengths{RunLengths...};
+    static constexpr std::size_t num_presorted = (0_z + ... + RunLengths);
+    static_assert(num_presorted <= N, "the presorted runs exceed the number of values");
+
+    // the inputs are enumerated as all values in arbitrary order (in groups of
+    // up to 64 inputs) for every combination of the sequences of the runs
+    static constexpr std::size_t num_arbitrary_inputs = 1_z << (N - num_presorted);
+    static constexpr std::size_t group_size = std::min(num_arbitrary_inputs, 64_z);
+    static constexpr std::size_t num_run_inputs = (1_z * ... * (RunLengths + 1_z));
+    static constexpr std::size_t num_groups = num_run_inputs * (num_arbitrary_inputs / group_size);
+
+    static_assert(num_groups <= max_presorted_input_groups,
+                  "too many inputs to prune the network for the presorted runs at compile time");
+
+    using words = std::array<std::uint64_t, int_div_ceil(num_run_inputs * num_arbitrary_inputs, 64_z)>;
+    using flattened = flattened_network<Network>;
+
+    static constexpr std::array<words, N> make_inputs()
+    {
+      // bit k of the word of the value j < 6 in arbitrary order is bit j of k
+      constexpr std::array<std::uint64_t, 6> low_bits{0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0,
+                                                      0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000};
+      constexpr std::uint64_t group_mask =
+        group_size == 64_z ? ~std::uint64_t{0} : (std::uint64_t{1} << group_size) - 1_z;
+
+      std::array<words, N> result{};
+
+      for (std::size_t group = 0; group < num_groups; ++group)
+      {
+        const std::size_t first_input = group * group_size;
+        auto set_bits = [&, w = first_input / 64_z, shift = first_input % 64_z](const std::size_t i,
+                                                                                  const std::uint64_t bits) {
+          result[i][w] |= (bits & group_mask) << shift;
+        };
+
+        // the digits of the run input are the number of ones of each run
+        std::size_t digits = first_input / num_arbitrary_inputs;
+        std::size_t i = 0;
+
+        for (const std::size_t length : run_lengths)
+        {
+          const std::size_t num_ones = digits % (length + 1_z);
+          digits /= length + 1_z;
+
+          for (std::size_t j = 0; j < length; ++j, ++i)
+            set_bits(i, j >= length - num_ones ? ~std::uint64_t{0} : 0);
+        }
+
+        const std::size_t arbitrary_group = first_input % num_arbitrary_inputs / group_size;
+
+        for (std::size_t j = 0; i < N; ++i, ++j)
+          set_bits(i, j < 6 ? low_bits[j] : ((arbitrary_group >> (j - 6)) & 1 ? ~std::uint64_t{0} : 0));
+      }
+
+      return result;
+    }
+
+    static constexpr std::array<bool, flattened::comparators.size()> make_swaps()
+    {
+      std::array<bool, flattened::comparators.size()> result{};
+      std::array<words, N> values = make_inputs();
+
+      for (std::size_t c = 0; c < flattened::comparators.size(); ++c)
+      {
+        words& a = values[flattened::comparators[c].a];
+        words& b = values[flattened::comparators[c].b];
+        std::uint64_t swapped = 0;
+
+        for (std::size_t w = 0; w < a.size(); ++w)
+        {
+          const std::uint64_t a_cpy = a[w];
+
+          swapped |= a_cpy & ~b[w];
+          a[w] &= b[w];
+          b[w] |= a_cpy;
+        }
+
+        result[c] = swapped != 0;
+      }
+
+      return result;
+    }
+
+    static constexpr std::array<bool, flattened::comparators.size()> swaps = make_swaps();
+
+    static constexpr std::size_t num_remaining()
+    {
+      std::size_t result = 0;
+
+      for (const bool s : swaps)
+        result += s ? 1_z : 0_z;
+
+      return result;
+    }
+
+    static constexpr std::array<comparator, num_remaining()> make_remaining()
+    {
+      std::array<comparator, num_remaining()> result{};
+
+      for (std::size_t c = 0, i = 0; c < swaps.size(); ++c)
+        if (swaps[c])
+          result[i++] = flattened::comparators[c];
+
+      return result;
+    }
+
+    static constexpr std::array<comparator, num_remaining()> remaining = make_remaining();
+
+    template<std::size_t... Indices>
+    static auto gen_cas(std::index_sequence<Indices...>)
+      -> sorting_net::layer<sorting_net::cas_node<remaining[Indices].a, remaining[Indices].b>...>
+    {
+      return {};
+    }
+
+  public:
+    using type = sorting_net::net<decltype(gen_cas(std::make_index_sequence<num_remaining()>()))>;
+  };
+}  // namespace quxflux::sorting_net::detail
+
+namespace quxflux::sorting_net::detail
+{
+  // type::rank_sort is no comparator network: every value is compared to all
+  // other values to count the values preceding it (its rank), and is stored at
+  // its rank afterwards. The network representation of type::rank_sort, which
+  // is used when comparators are required (e.g. with custom compare and swap
+  // operations, counting_compare_and_swap or the vector backends), is the one
+  // of type::bose_nelson_sort.
+  template<std::size_t N>
+  struct sorting_network<N, type::rank_sort, std::enable_if_t<(N <= 16)>> : sorting_network<N, type::bose_nelson_sort>
+  {};
+
+  // The predicate of the compare and swap operations provided by the library
+  template<typename CAS>
+  struct compare_and_swap_predicate
+  {};
+
+  template<typename T, typename Predicate>
+  struct compare_and_swap_predicate<compare_and_swap<T, Predicate>>
+  {
+    using type = Predicate;
+  };
+
+  template<typename T, typename Predicate>
+  struct compare_and_swap_predicate<move_compare_and_swap<T, Predicate>>
+  {
+    using type = Predicate;
+  };
+
+  template<typename CAS, typename = void>
+  struct has_compare_and_swap_predicate : std::false_type
+  {};
+
+  template<typename CAS>
+  struct has_compare_and_swap_predicate<CAS, std::void_t<typename compare_and_swap_predicate<CAS>::type>>
+    : std::true_type
+  {};
+
+  template<std::size_t N>
+  struct sorter<N, type::rank_sort>
+  {
+  private:
+    // Of two values, the smaller one precedes the other; of two equal values,
+    // the one with the lower index precedes the other, which makes the sort
+    // stable
+    template<typename Predicate, std::size_t I, std::size_t J, typename T>
+    static constexpr void count_preceding(const std::array<T, N>& values, std::array<std::size_t, N>& ranks) noexcept
+    {
+      const std::size_t j_precedes_i = Predicate{}(values[J], values[I]) ? 1 : 0;
+
+      ranks[I] += j_precedes_i;
+      ranks[J] += 1 - j_precedes_i;
+    }
+
+    template<typename Predicate, std::size_t I, typename T, std::size_t... Js>
+    static constexpr void count_preceding(const std::array<T, N>& values, std::array<std::size_t, N>& ranks,
+                                          std::index_sequence<Js...>) noexcept
+    {
+      (count_preceding<Predicate, I, I + 1 + Js>(values, ranks), ...);
+    }
+
+    template<typename Predicate, typename It, std::size_t... Is>
+    static constexpr void rank_sort(const It begin, std::index_sequence<Is...>) noexcept
+    {
+      const std::array<typename std::iterator_traits<It>::value_type, N> values{begin[Is]...};
+      std::array<std::size_t, N> ranks{};
+
+      // every pair of values is compared once
+      (count_preceding<Predicate, Is>(values, ranks, std::make_index_sequence<N - 1 - Is>{}), ...);
+
+      ((begin[ranks[Is]] = values[Is]), ...);
+    }
+
+  public:
+    // Only the compare and swap operations provided by the library define the
+    // order by a predicate the ranks can be computed with; all others (and
+    // values which are not trivially copyable) are sorted by the network
+    template<typename ExecutionPolicy, typename It, typename CAS>
+    static constexpr void sort(const ExecutionPolicy policy, const It begin, const CAS& cas) noexcept
+    {
+      using value_type = typename std::iterator_traits<It>::value_type;
+
+      if constexpr (has_compare_and_swap_predicate<CAS>::value && std::is_trivially_copyable_v<value_type>)
+        rank_sort<typename compare_and_swap_predicate<CAS>::type>(begin, std::make_index_sequence<N>{});
+      else
+        execute<N>(policy, begin, cas, typename sorting_network<N, type::rank_sort>::type{});
+    }
+  };
+}  // namespace quxflux::sorting_net::detail
+
 namespace quxflux::sorting_net::detail
 {
   namespace sorter_hunter
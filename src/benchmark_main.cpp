@@ -15,9 +15,14 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 
 #include <array>
+#include <charconv>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <set>
+#include <string_view>
+#include <vector>
 
 #include <sorting_network_cpp/sorting_network.h>
 
@@ -94,38 +99,250 @@ namespace quxflux
 
       return os;
     }
+
+    struct working_set_scenario
+    {
+      std::string_view data_type;
+      std::size_t n = 0;
+      std::size_t working_set_size = 0;
+
+      constexpr bool operator<(const working_set_scenario& rhs) const
+      {
+        return std::tie(data_type, n, working_set_size) < std::tie(rhs.data_type, rhs.n, rhs.working_set_size);
+      }
+    };
+
+    // sorted bytes per second for each algorithm
+    using working_set_table = std::map<working_set_scenario, std::map<std::string_view, std::optional<double>>>;
+
+    std::ostream& operator<<(std::ostream& os, const working_set_table& table)
+    {
+      os << "compiler\tdata type\tN\tworking set (bytes)\t";
+
+      if (table.empty())
+        return os;
+
+      for ([[maybe_unused]] const auto& [algorithm, bytes_per_second] : table.begin()->second)
+      {
+        os << algorithm << '\t';
+      }
+
+      os << '\n';
+
+      for (const auto& scenario : table)
+      {
+        os << compiler_id << '\t' << scenario.first.data_type << '\t' << scenario.first.n << '\t'
+           << scenario.first.working_set_size << '\t';
+
+        for (const auto [algorithm, bytes_per_second] : scenario.second)
+        {
+          if (bytes_per_second.has_value())
+            os << *bytes_per_second;
+          else
+            os << ' ';
+
+          os << '\t';
+        }
+
+        os << '\n';
+      }
+
+      return os;
+    }
+
+    // working set sizes used for the sweep by default; chosen to fit into the L1
+    // data cache, the L2 cache and the L3 cache of common desktop and server
+    // processors and to exceed all caches respectively
+    constexpr std::array<std::size_t, 4> default_working_set_sizes{16 << 10, 128 << 10, 4 << 20, 256 << 20};
+
+    constexpr std::string_view usage =
+      "usage: sorting_network_cpp_benchmark [--mode=throughput|latency] [--output=<file>]\n"
+      "                                     [--working-set-sweep | --working-sets=<size>[K|M|G],...]\n"
+      "                                     [--data-types=<type>,...] [--sizes=<N>,...]";
+
+    struct command_line_options
+    {
+      benchmark_config config;
+      std::optional<std::string> output_path;
+      std::vector<std::size_t> working_set_sizes;
+    };
+
+    std::optional<std::size_t> parse_size(const std::string_view str)
+    {
+      std::size_t value = 0;
+      const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+      if (ec != std::errc{} || ptr == str.data())
+        return std::nullopt;
+
+      const std::string_view suffix{ptr, static_cast<std::size_t>(str.data() + str.size() - ptr)};
+
+      if (suffix.empty())
+        return value;
+      if (suffix == "K")
+        return value << 10;
+      if (suffix == "M")
+        return value << 20;
+      if (suffix == "G")
+        return value << 30;
+
+      return std::nullopt;
+    }
+
+    template<typename F>
+    bool for_each_list_element(std::string_view list, const F& f)
+    {
+      while (!list.empty())
+      {
+        const auto separator = std::min(list.find(','), list.size());
+
+        if (!f(list.substr(0, separator)))
+          return false;
+
+        list.remove_prefix(std::min(separator + 1, list.size()));
+      }
+
+      return true;
+    }
+
+    std::optional<command_line_options> parse_command_line(const int argc, const char** argv)
+    {
+      command_line_options options;
+
+      for (int i = 1; i < argc; ++i)
+      {
+        const std::string_view arg = argv[i];
+
+        const auto value_of = [&](const std::string_view option) -> std::optional<std::string_view> {
+          if (arg.substr(0, option.size()) != option)
+            return std::nullopt;
+
+          return arg.substr(option.size());
+        };
+
+        if (const auto mode = value_of("--mode="))
+        {
+          if (*mode == "throughput")
+            options.config.mode = benchmark_mode::throughput;
+          else if (*mode == "latency")
+            options.config.mode = benchmark_mode::latency;
+          else
+            return std::nullopt;
+        } else if (const auto output_path = value_of("--output="))
+        {
+          options.output_path = std::string{*output_path};
+        } else if (arg == "--working-set-sweep")
+        {
+          options.working_set_sizes.assign(default_working_set_sizes.begin(), default_working_set_sizes.end());
+        } else if (const auto sizes = value_of("--working-sets="))
+        {
+          options.working_set_sizes.clear();
+
+          const bool valid = for_each_list_element(*sizes, [&](const std::string_view element) {
+            const auto size = parse_size(element);
+            if (size && *size > 0)
+              options.working_set_sizes.push_back(*size);
+            return size && *size > 0;
+          });
+
+          if (!valid)
+            return std::nullopt;
+        } else if (const auto data_types = value_of("--data-types="))
+        {
+          for_each_list_element(*data_types, [&](const std::string_view element) {
+            options.config.data_types.emplace_back(element);
+            return true;
+          });
+        } else if (const auto sizes = value_of("--sizes="))
+        {
+          const bool valid = for_each_list_element(*sizes, [&](const std::string_view element) {
+            std::size_t n = 0;
+            const auto [ptr, ec] = std::from_chars(element.data(), element.data() + element.size(), n);
+            options.config.sizes.push_back(n);
+            return ec == std::errc{} && ptr == element.data() + element.size();
+          });
+
+          if (!valid)
+            return std::nullopt;
+        } else
+        {
+          return std::nullopt;
+        }
+      }
+
+      return options;
+    }
+
+    void run_all_benchmarks(const benchmark_config& config, std::set<benchmark_result>& benchmark_results)
+    {
+      run_benchmark<int16_t>(config, benchmark_results);
+      run_benchmark<int32_t>(config, benchmark_results);
+      run_benchmark<uint32_t>(config, benchmark_results);
+      run_benchmark<int64_t>(config, benchmark_results);
+      run_benchmark<float>(config, benchmark_results);
+      run_benchmark<double>(config, benchmark_results);
+      run_benchmark<vec2i>(config, benchmark_results);
+    }
   }  // namespace
 }  // namespace quxflux
 
-int main(int, const char**)
+int main(const int argc, const char** argv)
 {
   namespace qf = quxflux;
 
-  std::set<qf::benchmark_result> benchmark_results;
+  const auto options = qf::parse_command_line(argc, argv);
 
-  qf::run_benchmark<int16_t>(benchmark_results);
-  qf::run_benchmark<int32_t>(benchmark_results);
-  qf::run_benchmark<uint32_t>(benchmark_results);
-  qf::run_benchmark<int64_t>(benchmark_results);
-  qf::run_benchmark<float>(benchmark_results);
-  qf::run_benchmark<double>(benchmark_results);
-  qf::run_benchmark<qf::vec2i>(benchmark_results);
+  if (!options)
+  {
+    std::cerr << qf::usage << '\n';
+    return EXIT_FAILURE;
+  }
 
-  std::set<std::string_view> all_algorithm_names;
+  std::set<qf::benchmark_result> benchmark_results;
+
+  if (options->working_set_sizes.empty())
+  {
+    qf::run_all_benchmarks(options->config, benchmark_results);
 
-  for (const auto& benchmark_result : benchmark_results)
-    all_algorithm_names.insert(benchmark_result.algorithm);
+    qf::benchmark_table table;
 
-  qf::benchmark_table table;
+    for (const auto& benchmark_result : benchmark_results)
+    {
+      table[qf::benchmark_scenario{benchmark_result.data_type, benchmark_result.n}][benchmark_result.algorithm] =
+        benchmark_result.avg_exec_time;
+    }
 
-  for (const auto& benchmark_result : benchmark_results)
+    std::ofstream ofs(options->output_path.value_or("timings.csv"));
+    ofs << table;
+  } else
   {
-    table[qf::benchmark_scenario{benchmark_result.data_type, benchmark_result.n}][benchmark_result.algorithm] =
-      benchmark_result.avg_exec_time;
-  }
+    for (const auto working_set_size : options->working_set_sizes)
+    {
+      auto config = options->config;
+      config.working_set_size = working_set_size;
+
+      qf::run_all_benchmarks(config, benchmark_results);
+    }
+
+    qf::working_set_table table;
+
+    for (const auto& benchmark_result : benchmark_results)
+    {
+      const qf::working_set_scenario scenario{benchmark_result.data_type, benchmark_result.n,
+                                              benchmark_result.working_set_size};
 
-  std::ofstream ofs("timings.csv");
-  ofs << table;
+      auto& bytes_per_second = table[scenario][benchmark_result.algorithm];
+
+      if (benchmark_result.avg_exec_time)
+      {
+        using seconds = std::chrono::duration<double>;
+        bytes_per_second = benchmark_result.processed_bytes / seconds(*benchmark_result.avg_exec_time).count();
+      }
+    }
+
+    std::ofstream ofs(options->output_path.value_or("working_set_sweep.csv"));
+    ofs << table;
+  }
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,34 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/precompiled_sorting_network.h>
+#include <sorting_network_cpp/sorting_network.h>
+
+namespace quxflux::sorting_net
+{
+  template<std::size_t N, type NetworkType, typename T>
+  void precompiled_sort(T* const begin) noexcept
+  {
+    sorting_network<N, NetworkType>{}(begin);
+  }
+
+#define SORTING_NETWORK_CPP_INSTANTIATE_PRECOMPILED(T, N, NetworkType)                                                 \
+  template void precompiled_sort<N, NetworkType, T>(T* begin) noexcept;
+
+  SORTING_NETWORK_CPP_PRECOMPILED(SORTING_NETWORK_CPP_INSTANTIATE_PRECOMPILED)
+
+#undef SORTING_NETWORK_CPP_INSTANTIATE_PRECOMPILED
+}  // namespace quxflux::sorting_net
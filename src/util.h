@@ -16,8 +16,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <optional>
@@ -29,8 +32,20 @@
 #include <typeinfo>
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 
+#include <sorting_network_cpp/dispatched_sorting_network.h>
 #include <sorting_network_cpp/sorting_network.h>
+#include <sorting_network_cpp/swar_sorting_network.h>
+#include <sorting_network_cpp/vector_sorting_network.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SN_BENCHMARK_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define SN_BENCHMARK_HAS_RDTSC
+#endif
 
 namespace quxflux
 {
@@ -41,6 +56,34 @@ namespace quxflux
 
   using duration_t = std::chrono::duration<double, std::milli>;
 
+  enum class benchmark_mode
+  {
+    // independent arrays are sorted back to back, the execution of consecutive
+    // sorts may overlap
+    throughput,
+    // every input depends on the output of the previous sort, so that each sort
+    // has to be completed before the next one can start
+    latency
+  };
+
+  struct benchmark_config
+  {
+    benchmark_mode mode = benchmark_mode::throughput;
+
+    // total number of arrays sorted per measurement
+    std::size_t num_arrays = 1'000'000;
+
+    // when set, only as many arrays as fit into the given number of bytes are
+    // generated; this batch is sorted repeatedly until at least num_arrays
+    // arrays have been sorted
+    std::optional<std::size_t> working_set_size;
+
+    // restrict the benchmark to the given data types / problem sizes (all are
+    // benchmarked if empty)
+    std::vector<std::string> data_types;
+    std::vector<std::size_t> sizes;
+  };
+
   struct benchmark_result
   {
     std::string_view data_type;
@@ -49,18 +92,24 @@ namespace quxflux
 
     std::optional<duration_t> avg_exec_time;
 
+    // size of the batch of arrays which was sorted (in bytes) and the total
+    // amount of data sorted during the measurement (in bytes)
+    std::size_t working_set_size = 0;
+    std::size_t processed_bytes = 0;
+
     constexpr bool operator<(const benchmark_result& rhs) const
     {
-      return std::tie(data_type, n, algorithm) < std::tie(rhs.data_type, rhs.n, rhs.algorithm);
+      return std::tie(data_type, n, working_set_size, algorithm) <
+             std::tie(rhs.data_type, rhs.n, rhs.working_set_size, rhs.algorithm);
     }
   };
 
   namespace detail
   {
     template<typename T, std::size_t N>
-    std::vector<std::array<T, N>> generate_benchmark_data()
+    std::vector<std::array<T, N>> generate_benchmark_data(const std::size_t num_arrays)
     {
-      std::vector<std::array<T, N>> unsorted_data(1'000'000);
+      std::vector<std::array<T, N>> unsorted_data(num_arrays);
       std::mt19937 rd(42);
 
       for (auto& array : unsorted_data)
@@ -88,17 +137,75 @@ namespace quxflux
       return unsorted_data;
     }
 
-    template<typename Duration, typename F, typename... Args>
-    Duration measure_execution_time(const F& f, Args&&... args)
+    inline std::uint64_t read_time_stamp_counter() noexcept
+    {
+#if defined(SN_BENCHMARK_HAS_RDTSC)
+      return __rdtsc();
+#else
+      return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+#endif
+    }
+
+    // Returns the number of time stamp counter ticks per millisecond, determined
+    // once by comparing the counter against std::chrono::steady_clock
+    inline double time_stamp_counter_ticks_per_ms()
     {
-      using clock = std::conditional_t<std::chrono::high_resolution_clock::is_steady,
-                                       std::chrono::high_resolution_clock, std::chrono::steady_clock>;
+      static const double ticks_per_ms = [] {
+        using clock = std::chrono::steady_clock;
+
+        const auto start_time = clock::now();
+        const auto start_ticks = read_time_stamp_counter();
+
+        while (clock::now() - start_time < std::chrono::milliseconds(200))
+          ;
+
+        const auto end_ticks = read_time_stamp_counter();
+        const auto end_time = clock::now();
+
+        return static_cast<double>(end_ticks - start_ticks) / duration_t(end_time - start_time).count();
+      }();
+
+      return ticks_per_ms;
+    }
+
+    template<typename F>
+    duration_t measure_execution_time(const F& f)
+    {
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      const auto start = read_time_stamp_counter();
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+
+      f();
+
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      const auto end = read_time_stamp_counter();
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+
+      return duration_t{static_cast<double>(end - start) / time_stamp_counter_ticks_per_ms()};
+    }
+
+    // Returns fresh with its lowest bit flipped if the lowest bit of previous is
+    // set. This makes the next input of a sort depend on the output of the
+    // previous one while leaving the distribution of the values virtually
+    // unchanged.
+    template<typename T>
+    T chain(const T& fresh, const T& previous) noexcept
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+
+      unsigned char fresh_bytes[sizeof(T)];
+      unsigned char previous_byte;
+
+      std::memcpy(fresh_bytes, &fresh, sizeof(T));
+      std::memcpy(&previous_byte, &previous, 1);
 
-      const auto start = clock::now();
-      f(std::forward<Args>(args)...);
-      const auto end = clock::now();
+      fresh_bytes[0] ^= previous_byte & 1u;
 
-      return std::chrono::duration_cast<Duration>(end - start);
+      T result;
+      std::memcpy(&result, fresh_bytes, sizeof(T));
+      return result;
     }
 
     template<typename T>
@@ -133,6 +240,9 @@ namespace quxflux
         std::pair{SN::bitonic_merge_sort, "SN::bitonic_merge_sort"},                    //
         std::pair{SN::size_optimized_sort, "SN::size_optimized_sort"},                  //
         std::pair{SN::bose_nelson_sort, "SN::bose_nelson_sort"},                        //
+        std::pair{SN::rank_sort, "SN::rank_sort"},                                      //
+        std::pair{SN::odd_even_transposition_sort, "SN::odd_even_transposition_sort"},  //
+        std::pair{SN::pairwise_sort, "SN::pairwise_sort"},                              //
       };
 
       const auto it = name_map.find(NWT);
@@ -142,27 +252,112 @@ namespace quxflux
       return it->second;
     }
 
-    template<typename T, std::size_t N, typename F>
-    auto benchmark_sorting_function(const F& f)
+    template<std::size_t N, typename T, typename F>
+    duration_t sort_batch(const benchmark_mode mode, std::vector<std::array<T, N>>& data_to_sort, const F& f)
     {
-      auto data_to_sort = generate_benchmark_data<T, N>();
+      if (mode == benchmark_mode::latency)
+      {
+        return measure_execution_time([&] {
+          f(data_to_sort.front().begin());
+
+          for (std::size_t i = 1; i < data_to_sort.size(); ++i)
+          {
+            const auto& previous = data_to_sort[i - 1];
+            auto& current = data_to_sort[i];
+
+            for (std::size_t j = 0; j < N; ++j)
+              current[j] = chain(current[j], previous[j]);
+
+            f(current.begin());
+          }
+        });
+      }
+
+      return measure_execution_time([&] {
+        for (auto& array : data_to_sort)
+          f(array.begin());
+      });
+    }
+
+    template<typename T, std::size_t N>
+    std::size_t batch_size(const benchmark_config& config)
+    {
+      if (!config.working_set_size)
+        return config.num_arrays;
+
+      return std::max(*config.working_set_size / sizeof(std::array<T, N>), std::size_t{1});
+    }
+
+    struct benchmark_measurement
+    {
+      duration_t duration{};
+      std::size_t processed_bytes = 0;
+    };
+
+    // Transposes groups of Lanes arrays such that element j of the arrays of a
+    // group is stored in vector j (lane i holds the i-th array of the group);
+    // the last group is padded with zeros
+    template<std::size_t Lanes, typename T, std::size_t N>
+    auto to_lanes(std::vector<std::array<T, N>> data)
+    {
+      if constexpr (Lanes == 1)
+      {
+        return data;
+      } else
+      {
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+        std::vector<std::array<quxflux::sorting_net::vector_t<T, Lanes>, N>> result((data.size() + Lanes - 1) / Lanes);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+          for (std::size_t j = 0; j < N; ++j)
+            result[i / Lanes][j][i % Lanes] = data[i][j];
+
+        return result;
+#endif
+      }
+    }
+
+    // Measures f sorting config.num_arrays arrays of N values of type T; for
+    // Lanes > 1 f sorts Lanes arrays at once, which are passed as N vectors
+    // (see to_lanes)
+    template<typename T, std::size_t N, std::size_t Lanes = 1, typename F>
+    benchmark_measurement benchmark_sorting_function(const benchmark_config& config, const F& f)
+    {
+      using array_t = std::array<T, N>;
+
+      const std::size_t batch_size = detail::batch_size<T, N>(config);
+      auto data_to_sort = to_lanes<Lanes>(generate_benchmark_data<T, N>(batch_size));
+
+      if (batch_size == config.num_arrays)
+      {
+        const auto duration = sort_batch(config.mode, data_to_sort, f);
+        return {duration, batch_size * sizeof(array_t)};
+      }
+
+      // the batch is restored before each pass (untimed), which also brings it
+      // into the caches if it fits
+      const auto unsorted_data = data_to_sort;
 
-      duration_t sum{};
+      benchmark_measurement result;
 
-      for (std::size_t i = 0; i < data_to_sort.size(); ++i)
+      for (std::size_t num_sorted = 0; num_sorted < config.num_arrays; num_sorted += batch_size)
       {
-        sum += measure_execution_time<duration_t>(f, data_to_sort[i].begin());
+        std::copy(unsorted_data.begin(), unsorted_data.end(), data_to_sort.begin());
+
+        result.duration += sort_batch(config.mode, data_to_sort, f);
+        result.processed_bytes += batch_size * sizeof(array_t);
       }
 
-      return sum;
+      return result;
     }
 
     template<typename ValueType, std::size_t N, quxflux::sorting_net::type type>
     struct sorting_network_benchmark
     {
-      benchmark_result operator()() const
+      benchmark_result operator()(const benchmark_config& config) const
       {
-        benchmark_result result{to_string<ValueType>(), N, to_string<type>()};
+        benchmark_result result{to_string<ValueType>(), N, to_string<type>(), std::nullopt,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>)};
 
         if constexpr (quxflux::sorting_net::available_v<N, type>)
         {
@@ -182,10 +377,11 @@ namespace quxflux
             return result;
           } else
           {
-            const auto duration = benchmark_sorting_function<ValueType, N>(
-              [](const auto it) { quxflux::sorting_net::sorting_network<N, type>{}(it); });
+            const auto measurement = benchmark_sorting_function<ValueType, N>(
+              config, [](const auto it) { quxflux::sorting_net::sorting_network<N, type>{}(it); });
 
-            result.avg_exec_time = duration;
+            result.avg_exec_time = measurement.duration;
+            result.processed_bytes = measurement.processed_bytes;
           }
         }
 
@@ -193,31 +389,165 @@ namespace quxflux
       }
     };
 
+    // sorts the values packed into a single 64 bit word; only measured for
+    // integral types with N * sizeof(T) <= 8
+    template<typename ValueType, std::size_t N>
+    struct swar_sorting_network_benchmark
+    {
+      benchmark_result operator()(const benchmark_config& config) const
+      {
+        benchmark_result result{to_string<ValueType>(), N, "SWAR", std::nullopt,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>)};
+
+        if constexpr (N > 1 && quxflux::sorting_net::swar_available_v<ValueType, N>)
+        {
+          std::clog << to_string<ValueType>() << ", " << N << " item(s), SWAR\n";
+
+          const auto measurement = benchmark_sorting_function<ValueType, N>(
+            config, [](const auto it) { quxflux::sorting_net::swar_sorting_network<N>{}(it); });
+
+          result.avg_exec_time = measurement.duration;
+          result.processed_bytes = measurement.processed_bytes;
+        }
+
+        return result;
+      }
+    };
+
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+    // sorts every array in a single vector; only measured if the vector does
+    // not exceed 64 bytes (the size of an AVX-512 register)
+    template<typename ValueType, std::size_t N>
+    struct vector_sorting_network_benchmark
+    {
+      benchmark_result operator()(const benchmark_config& config) const
+      {
+        using network_t = quxflux::sorting_net::vector_sorting_network<N>;
+
+        benchmark_result result{to_string<ValueType>(), N, "vector", std::nullopt,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>)};
+
+        if constexpr (N > 1 && quxflux::sorting_net::vector_available_v<ValueType> &&
+                      network_t::lanes * sizeof(ValueType) <= 64)
+        {
+          std::clog << to_string<ValueType>() << ", " << N << " item(s), vector\n";
+
+          const auto measurement =
+            benchmark_sorting_function<ValueType, N>(config, [](const auto it) { network_t{}(it); });
+
+          result.avg_exec_time = measurement.duration;
+          result.processed_bytes = measurement.processed_bytes;
+        }
+
+        return result;
+      }
+    };
+
+    // sorts 64 / sizeof(ValueType) arrays at once with vector_compare_and_swap
+    template<typename ValueType, std::size_t N>
+    struct vector_lanes_sorting_network_benchmark
+    {
+      benchmark_result operator()(const benchmark_config& config) const
+      {
+        benchmark_result result{to_string<ValueType>(), N, "vector lanes", std::nullopt,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>)};
+
+        if constexpr (N > 1 && quxflux::sorting_net::vector_available_v<ValueType>)
+        {
+          constexpr std::size_t lanes = 64 / sizeof(ValueType);
+          using cas_t = quxflux::sorting_net::vector_compare_and_swap<ValueType, lanes>;
+
+          std::clog << to_string<ValueType>() << ", " << N << " item(s), vector lanes\n";
+
+          const auto measurement = benchmark_sorting_function<ValueType, N, lanes>(
+            config, [](const auto it) { quxflux::sorting_net::sorting_network<N>{}(it, cas_t{}); });
+
+          result.avg_exec_time = measurement.duration;
+          result.processed_bytes = measurement.processed_bytes;
+        }
+
+        return result;
+      }
+    };
+#endif
+
+#if defined(SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT)
+    // sorts 32 bit values with the bitonic network executed in AVX-512
+    // registers; only measured if the CPU supports AVX-512
+    template<typename ValueType, std::size_t N>
+    struct avx512_bitonic_sort_benchmark
+    {
+      benchmark_result operator()(const benchmark_config& config) const
+      {
+        benchmark_result result{to_string<ValueType>(), N, "AVX-512 bitonic", std::nullopt,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>)};
+
+        if constexpr (N >= 16 && quxflux::sorting_net::avx512_bitonic_sort_available_v<ValueType, N>)
+        {
+          if (quxflux::sorting_net::detected_isa() != quxflux::sorting_net::isa::avx512)
+            return result;
+
+          std::clog << to_string<ValueType>() << ", " << N << " item(s), AVX-512 bitonic\n";
+
+          const auto measurement = benchmark_sorting_function<ValueType, N>(
+            config, [](const auto it) { quxflux::sorting_net::avx512_bitonic_sort<N>{}(&*it); });
+
+          result.avg_exec_time = measurement.duration;
+          result.processed_bytes = measurement.processed_bytes;
+        }
+
+        return result;
+      }
+    };
+#endif
+
     template<typename ValueType, std::size_t N>
     struct std_sort_benchmark
     {
-      benchmark_result operator()() const
+      benchmark_result operator()(const benchmark_config& config) const
       {
         std::clog << to_string<ValueType>() << ", " << N << " item(s), std::sort\n";
 
-        const auto duration = benchmark_sorting_function<ValueType, N>([](const auto it) { std::sort(it, it + N); });
+        const auto measurement =
+          benchmark_sorting_function<ValueType, N>(config, [](const auto it) { std::sort(it, it + N); });
 
-        return benchmark_result{to_string<ValueType>(), N, "std::sort", duration};
+        return benchmark_result{to_string<ValueType>(),
+                                N,
+                                "std::sort",
+                                measurement.duration,
+                                batch_size<ValueType, N>(config) * sizeof(std::array<ValueType, N>),
+                                measurement.processed_bytes};
       }
     };
 
     template<std::size_t N, typename ValueType>
-    void benchmark_all_with_size_and_type(std::set<benchmark_result>& benchmark_results)
+    void benchmark_all_with_size_and_type(const benchmark_config& config, std::set<benchmark_result>& benchmark_results)
     {
       using network_type = quxflux::sorting_net::type;
 
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::batcher_odd_even_merge_sort>{}());
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bitonic_merge_sort>{}());
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bose_nelson_sort>{}());
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bubble_sort>{}());
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::insertion_sort>{}());
-      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::size_optimized_sort>{}());
-      benchmark_results.insert(std_sort_benchmark<ValueType, N>{}());
+      if (!config.sizes.empty() && std::find(config.sizes.begin(), config.sizes.end(), N) == config.sizes.end())
+        return;
+
+      benchmark_results.insert(
+        sorting_network_benchmark<ValueType, N, network_type::batcher_odd_even_merge_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bitonic_merge_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bose_nelson_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::bubble_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::insertion_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::size_optimized_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::rank_sort>{}(config));
+      benchmark_results.insert(
+        sorting_network_benchmark<ValueType, N, network_type::odd_even_transposition_sort>{}(config));
+      benchmark_results.insert(sorting_network_benchmark<ValueType, N, network_type::pairwise_sort>{}(config));
+      benchmark_results.insert(swar_sorting_network_benchmark<ValueType, N>{}(config));
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+      benchmark_results.insert(vector_sorting_network_benchmark<ValueType, N>{}(config));
+      benchmark_results.insert(vector_lanes_sorting_network_benchmark<ValueType, N>{}(config));
+#endif
+#if defined(SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT)
+      benchmark_results.insert(avx512_bitonic_sort_benchmark<ValueType, N>{}(config));
+#endif
+      benchmark_results.insert(std_sort_benchmark<ValueType, N>{}(config));
 
       std::clog << '\n';
     }
@@ -225,29 +555,40 @@ namespace quxflux
     template<typename T>
     struct benchmark_impl
     {
-      void operator()(std::set<benchmark_result>& benchmark_results) const;
+      void operator()(const benchmark_config& config, std::set<benchmark_result>& benchmark_results) const;
     };
   }  // namespace detail
 
   template<typename T>
-  void run_benchmark(std::set<benchmark_result>& benchmark_results)
+  void run_benchmark(const benchmark_config& config, std::set<benchmark_result>& benchmark_results)
   {
-    detail::benchmark_impl<T>{}(benchmark_results);
+    const auto& data_types = config.data_types;
+
+    const bool is_selected =
+      data_types.empty() || std::find(data_types.begin(), data_types.end(), detail::to_string<T>()) != data_types.end();
+
+    if (!is_selected)
+      return;
+
+    detail::benchmark_impl<T>{}(config, benchmark_results);
   }
 }  // namespace quxflux
 
 #define IMPL_BENCHMARK(T)                                                                                              \
   template<>                                                                                                           \
-  void detail::benchmark_impl<T>::operator()(std::set<benchmark_result>& benchmark_results) const                    \
+  void detail::benchmark_impl<T>::operator()(const benchmark_config& config,                                           \
+                                             std::set<benchmark_result>& benchmark_results) const                      \
   {                                                                                                                    \
-    benchmark_all_with_size_and_type<1, T>(benchmark_results);                                                       \
-    benchmark_all_with_size_and_type<2, T>(benchmark_results);                                                       \
-    benchmark_all_with_size_and_type<4, T>(benchmark_results);                                                       \
-    benchmark_all_with_size_and_type<8, T>(benchmark_results);                                                       \
-    benchmark_all_with_size_and_type<16, T>(benchmark_results);                                                      \
-    benchmark_all_with_size_and_type<32, T>(benchmark_results);                                                      \
-    benchmark_all_with_size_and_type<64, T>(benchmark_results);                                                      \
-    benchmark_all_with_size_and_type<128, T>(benchmark_results);                                                     \
+    benchmark_all_with_size_and_type<1, T>(config, benchmark_results);                                                 \
+    benchmark_all_with_size_and_type<2, T>(config, benchmark_results);                                                 \
+    benchmark_all_with_size_and_type<4, T>(config, benchmark_results);                                                 \
+    benchmark_all_with_size_and_type<8, T>(config, benchmark_results);                                                 \
+    benchmark_all_with_size_and_type<16, T>(config, benchmark_results);                                                \
+    benchmark_all_with_size_and_type<24, T>(config, benchmark_results);                                                \
+    benchmark_all_with_size_and_type<32, T>(config, benchmark_results);                                                \
+    benchmark_all_with_size_and_type<48, T>(config, benchmark_results);                                                \
+    benchmark_all_with_size_and_type<64, T>(config, benchmark_results);                                                \
+    benchmark_all_with_size_and_type<128, T>(config, benchmark_results);                                               \
                                                                                                                        \
     std::clog << '\n';                                                                                                 \
   }                                                                                                                    \
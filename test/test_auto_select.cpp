@@ -0,0 +1,67 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "test_base.h"
+
+#include <sorting_network_cpp/networks/auto_select.h>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    struct tuned_type
+    {
+      int value;
+
+      constexpr bool operator<(const tuned_type& rhs) const { return value < rhs.value; }
+    };
+  }  // namespace
+
+  namespace detail
+  {
+    template<>
+    struct auto_select_table<tuned_type>
+    {
+      static constexpr std::array<type, 2> candidates(const std::size_t n)
+      {
+        if (n <= 40)
+          return {type::size_optimized_sort, type::insertion_sort};
+        return {type::bubble_sort, type::insertion_sort};
+      }
+    };
+  }  // namespace detail
+
+  INSTANTIATE_TYPED_TEST_SUITE_P(sorting_network_test_auto_select, sorting_network_test,
+                                 test_specs_for_network<type::auto_select>);
+
+  TEST(auto_select, uses_the_first_available_candidate_of_the_table)
+  {
+    EXPECT_EQ((detail::resolve_network_type<tuned_type, 8, type::auto_select>::value), type::size_optimized_sort);
+    EXPECT_EQ((detail::resolve_network_type<tuned_type, 33, type::auto_select>::value), type::insertion_sort);
+    EXPECT_EQ((detail::resolve_network_type<tuned_type, 41, type::auto_select>::value), type::bubble_sort);
+
+    std::array<tuned_type, 7> array{{{3}, {6}, {0}, {5}, {1}, {4}, {2}}};
+    sorting_network<7, type::auto_select>{}(array.begin());
+
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+  }
+
+  TEST(auto_select, defaults_to_bose_nelson_sort)
+  {
+    EXPECT_EQ((detail::resolve_network_type<custom_type, 12, type::auto_select>::value), type::bose_nelson_sort);
+    EXPECT_TRUE((available_v<35, type::auto_select>));
+  }
+}  // namespace quxflux::sorting_net
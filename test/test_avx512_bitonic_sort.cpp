@@ -0,0 +1,91 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/avx512_bitonic_sort.h>
+#include <sorting_network_cpp/dispatched_sorting_network.h>
+
+#if defined(SORTING_NETWORK_CPP_HAS_AVX512_BITONIC_SORT)
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename T, std::size_t N>
+    void expect_sorted_like_std_sort()
+    {
+      std::default_random_engine rd;
+
+      for (std::size_t i = 0; i < 100; ++i)
+      {
+        // the value behind the array must not be touched by the masked stores
+        std::array<T, N + 1> array;
+        std::generate(array.begin(), array.end(), [&] {
+          return static_cast<T>(std::uniform_int_distribution<std::int64_t>{-100'000, 100'000}(rd));
+        });
+
+        // the padding value may be part of the input
+        if (i % 2 == 0)
+          array[N / 2] = std::numeric_limits<T>::max();
+
+        auto expected = array;
+        std::sort(expected.begin(), expected.begin() + N);
+
+        avx512_bitonic_sort<N>{}(array.data());
+
+        EXPECT_EQ(array, expected);
+      }
+    }
+  }  // namespace
+
+  TEST(avx512_bitonic_sort, array_is_ordered)
+  {
+    if (detected_isa() != isa::avx512)
+      GTEST_SKIP() << "AVX-512 is not supported by the CPU";
+
+    expect_sorted_like_std_sort<float, 16>();
+    expect_sorted_like_std_sort<float, 17>();
+    expect_sorted_like_std_sort<float, 64>();
+    expect_sorted_like_std_sort<float, 100>();
+    expect_sorted_like_std_sort<float, 256>();
+    expect_sorted_like_std_sort<std::int32_t, 1>();
+    expect_sorted_like_std_sort<std::int32_t, 31>();
+    expect_sorted_like_std_sort<std::int32_t, 128>();
+    expect_sorted_like_std_sort<std::uint32_t, 33>();
+    expect_sorted_like_std_sort<std::uint32_t, 255>();
+  }
+
+  TEST(avx512_bitonic_sort, values_are_distributed_over_registers)
+  {
+    static_assert(avx512_bitonic_sort<1>::registers == 1);
+    static_assert(avx512_bitonic_sort<16>::registers == 1);
+    static_assert(avx512_bitonic_sort<17>::registers == 2);
+    static_assert(avx512_bitonic_sort<129>::registers == 16);
+
+    static_assert(avx512_bitonic_sort_available_v<float, 256>);
+    static_assert(!avx512_bitonic_sort_available_v<float, 257>);
+    static_assert(!avx512_bitonic_sort_available_v<double, 16>);
+  }
+}  // namespace quxflux::sorting_net
+
+#endif
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "zero_one_principle.h"
+
 #include <sorting_network_cpp/networks/common.h>
 
 #include <gmock/gmock.h>
@@ -70,6 +72,14 @@ namespace quxflux::sorting_net
       return "insertion_sort";
     if constexpr (Network == type::size_optimized_sort)
       return "size_optimized_sort";
+    if constexpr (Network == type::rank_sort)
+      return "rank_sort";
+    if constexpr (Network == type::odd_even_transposition_sort)
+      return "odd_even_transposition_sort";
+    if constexpr (Network == type::pairwise_sort)
+      return "pairwise_sort";
+    if constexpr (Network == type::auto_select)
+      return "auto_select";
   }
 
   template<typename Type>
@@ -230,10 +240,20 @@ namespace quxflux::sorting_net
     EXPECT_TRUE(std::is_permutation(this->array.begin(), this->array.end(), this->input_array.begin()));
   }
 
+  TYPED_TEST_P(sorting_network_test, all_zero_one_inputs_are_ordered)
+  {
+    // the comparators do not depend on the value type, so every network is verified once
+    if constexpr (!std::is_same_v<typename TypeParam::value_type, std::uint8_t>)
+      GTEST_SKIP();
+    else
+      EXPECT_TRUE(sorts_all_zero_one_inputs<TypeParam::array_size>(typename TypeParam::sorting_network_type{}));
+  }
+
   REGISTER_TYPED_TEST_SUITE_P(sorting_network_test,                                          //
                               array_is_ordered_when_input_is_random_ordered,                 //
                               array_is_ordered_when_input_is_reverse_ordered,                //
                               array_is_ordered_when_input_is_ordered,                        //
                               array_is_ordered_when_using_custom_compare_and_swap_operator,  //
-                              array_is_ordered_when_using_custom_predicate);
+                              array_is_ordered_when_using_custom_predicate,                  //
+                              all_zero_one_inputs_are_ordered);
 }  // namespace quxflux::sorting_net
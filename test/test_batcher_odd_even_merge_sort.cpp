@@ -18,9 +18,34 @@
 
 #include <sorting_network_cpp/networks/batcher_odd_even_merge_sort.h>
 
+#include <vector>
+
 namespace quxflux::sorting_net
 {
   INSTANTIATE_TYPED_TEST_SUITE_P(sorting_network_test_batcher_odd_even_merge_sort, sorting_network_test,
                                  test_specs_for_network<type::batcher_odd_even_merge_sort>);
 
+  namespace
+  {
+    template<std::size_t... Ns>
+    std::vector<std::size_t> num_comparators(std::index_sequence<Ns...>)
+    {
+      return {detail::num_comparators(
+        typename detail::sorting_network<Ns + 1, type::batcher_odd_even_merge_sort>::type{})...};
+    }
+  }  // namespace
+
+  TEST(batcher_odd_even_merge_sort, is_available_for_every_size)
+  {
+    EXPECT_TRUE((available_v<24, type::batcher_odd_even_merge_sort>));
+    EXPECT_TRUE((available_v<48, type::batcher_odd_even_merge_sort>));
+    EXPECT_TRUE((available_v<100, type::batcher_odd_even_merge_sort>));
+  }
+
+  TEST(batcher_odd_even_merge_sort, number_of_comparators_matches_merge_exchange)
+  {
+    // the number of comparators of Batcher's merge exchange given by Knuth, TAOCP Vol. 3, 5.3.4
+    EXPECT_THAT(num_comparators(std::make_index_sequence<16>{}),
+                ::testing::ElementsAre(0, 1, 3, 5, 9, 12, 16, 19, 26, 31, 37, 41, 48, 53, 59, 63));
+  }
 }  // namespace quxflux::sorting_net
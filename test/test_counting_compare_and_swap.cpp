@@ -0,0 +1,116 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/counting_compare_and_swap.h>
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename Stats>
+    void expect_consistent_counts(const Stats& stats)
+    {
+      EXPECT_EQ(std::accumulate(stats.swaps_per_comparator.begin(), stats.swaps_per_comparator.end(), 0_z),
+                stats.swaps);
+      EXPECT_EQ(std::accumulate(stats.swaps_per_layer.begin(), stats.swaps_per_layer.end(), 0_z), stats.swaps);
+    }
+  }  // namespace
+
+  TEST(counting_compare_and_swap, layers_are_derived_from_the_network)
+  {
+    using stats_t = compare_and_swap_stats<8, type::size_optimized_sort>;
+
+    EXPECT_EQ(stats_t::num_comparators, 19);
+    EXPECT_EQ(stats_t::depth, 6);
+
+    EXPECT_EQ((compare_and_swap_stats<16, type::bubble_sort>::depth), 2 * 16 - 3);
+  }
+
+  TEST(counting_compare_and_swap, nothing_is_swapped_when_input_is_ordered)
+  {
+    compare_and_swap_stats<16, type::batcher_odd_even_merge_sort> stats;
+
+    std::array<int, 16> array;
+    std::iota(array.begin(), array.end(), 0);
+
+    using cas_t = counting_compare_and_swap<int, std::less<int>, decltype(stats)>;
+    sorting_network<16, type::batcher_odd_even_merge_sort>{}(array.begin(), cas_t{stats});
+
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+    EXPECT_EQ(stats.comparisons, stats.num_comparators);
+    EXPECT_EQ(stats.num_sorts(), 1);
+    EXPECT_EQ(stats.swaps, 0);
+    expect_consistent_counts(stats);
+  }
+
+  TEST(counting_compare_and_swap, every_comparator_swaps_when_bubble_sorting_reverse_ordered_input)
+  {
+    compare_and_swap_stats<12, type::bubble_sort> stats;
+
+    std::array<int, 12> array;
+    std::iota(array.rbegin(), array.rend(), 0);
+
+    using cas_t = counting_compare_and_swap<int, std::less<int>, decltype(stats)>;
+    sorting_network<12, type::bubble_sort>{}(array.begin(), cas_t{stats});
+
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+    EXPECT_EQ(stats.swaps, stats.num_comparators);
+    EXPECT_THAT(stats.swaps_per_comparator, ::testing::Each(1));
+    expect_consistent_counts(stats);
+  }
+
+  TEST(counting_compare_and_swap, counts_accumulate_over_multiple_sorts)
+  {
+    compare_and_swap_stats<10> stats;
+    std::default_random_engine rd;
+
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      std::array<float, 10> array;
+      std::generate(array.begin(), array.end(), [&] { return std::uniform_real_distribution<float>{}(rd); });
+
+      using cas_t = counting_compare_and_swap<float, std::less<float>, decltype(stats)>;
+      sorting_network<10>{}(array.begin(), cas_t{stats});
+
+      EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+    }
+
+    EXPECT_EQ(stats.num_sorts(), 100);
+    EXPECT_EQ(stats.comparisons, 100 * stats.num_comparators);
+    EXPECT_GT(stats.swaps, 0);
+    EXPECT_LT(stats.swaps, stats.comparisons);
+    expect_consistent_counts(stats);
+  }
+
+  TEST(counting_compare_and_swap, disabled_stats_sort_like_compare_and_swap)
+  {
+    static_assert(std::is_empty_v<counting_compare_and_swap<int, std::greater<int>>>);
+
+    std::array<int, 9> array{4, 8, 1, 9, 0, 3, 7, 2, 5};
+
+    sorting_network<9>{}(array.begin(), counting_compare_and_swap<int, std::greater<int>>{});
+
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end(), std::greater<int>{}));
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,122 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/dispatched_sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// The kernel used by dispatched_sorting_network is selected by the
+// environment; CMakeLists.txt runs these tests once per instruction set level
+// with SORTING_NETWORK_CPP_ISA set accordingly
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename T>
+    std::vector<T> random_values(const std::size_t n)
+    {
+      std::default_random_engine rd;
+      std::vector<T> result(n);
+
+      std::generate(result.begin(), result.end(), [&] {
+        if constexpr (std::is_floating_point_v<T>)
+          return std::uniform_real_distribution<T>{-1000, 1000}(rd);
+        else
+          return static_cast<T>(std::uniform_int_distribution<std::int64_t>{-1000, 1000}(rd));
+      });
+
+      return result;
+    }
+
+    template<typename T, std::size_t N, type NetworkType>
+    void expect_arrays_sorted_like_std_sort()
+    {
+      // not a multiple of any number of lanes, so that the remainder is sorted one by one
+      constexpr std::size_t num_arrays = 203;
+
+      auto values = random_values<T>(num_arrays * N);
+      auto expected = values;
+
+      for (std::size_t i = 0; i < num_arrays; ++i)
+        std::sort(expected.begin() + i * N, expected.begin() + (i + 1) * N);
+
+      auto values_sorted_one_by_one = values;
+
+      for (std::size_t i = 0; i < num_arrays; ++i)
+        dispatched_sorting_network<N, NetworkType>{}(values_sorted_one_by_one.data() + i * N);
+
+      dispatched_sorting_network<N, NetworkType>{}(values.data(), num_arrays);
+
+      EXPECT_EQ(values_sorted_one_by_one, expected);
+      EXPECT_EQ(values, expected);
+    }
+
+    template<typename T>
+    void expect_arrays_sorted_like_std_sort()
+    {
+      expect_arrays_sorted_like_std_sort<T, 1, type::bose_nelson_sort>();
+      expect_arrays_sorted_like_std_sort<T, 3, type::insertion_sort>();
+      expect_arrays_sorted_like_std_sort<T, 8, type::size_optimized_sort>();
+      expect_arrays_sorted_like_std_sort<T, 13, type::bose_nelson_sort>();
+      expect_arrays_sorted_like_std_sort<T, 32, type::batcher_odd_even_merge_sort>();
+      expect_arrays_sorted_like_std_sort<T, 40, type::bitonic_merge_sort>();
+    }
+  }  // namespace
+
+  TEST(dispatched_sorting_network, isa_names_are_parsed)
+  {
+    isa level = isa::scalar;
+
+    EXPECT_TRUE(parse_isa("avx2", level));
+    EXPECT_EQ(level, isa::avx2);
+    EXPECT_TRUE(parse_isa("sse4.1", level));
+    EXPECT_EQ(level, isa::sse4_1);
+    EXPECT_TRUE(parse_isa("avx512", level));
+    EXPECT_EQ(level, isa::avx512);
+    EXPECT_TRUE(parse_isa("scalar", level));
+    EXPECT_EQ(level, isa::scalar);
+
+    EXPECT_FALSE(parse_isa("avx", level));
+    EXPECT_EQ(level, isa::scalar);
+  }
+
+  TEST(dispatched_sorting_network, forced_isa_is_selected_if_supported)
+  {
+    isa forced = detected_isa();
+
+    if (const char* name = std::getenv("SORTING_NETWORK_CPP_ISA"); name && *name)
+      ASSERT_TRUE(parse_isa(name, forced));
+
+    EXPECT_EQ(selected_isa(), std::min(forced, detected_isa()));
+  }
+
+  TEST(dispatched_sorting_network, arrays_are_ordered)
+  {
+    expect_arrays_sorted_like_std_sort<std::int8_t>();
+    expect_arrays_sorted_like_std_sort<std::int16_t>();
+    expect_arrays_sorted_like_std_sort<std::uint32_t>();
+    expect_arrays_sorted_like_std_sort<std::int64_t>();
+    expect_arrays_sorted_like_std_sort<float>();
+    expect_arrays_sorted_like_std_sort<double>();
+  }
+}  // namespace quxflux::sorting_net
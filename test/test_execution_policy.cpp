@@ -0,0 +1,130 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    // Compare and swap operation which counts the comparators executed on
+    // values inside of [begin, end)
+    struct address_recording_compare_and_swap
+    {
+      const int* begin;
+      const int* end;
+      std::size_t* num_accesses_in_range;
+
+      void operator()(int& a, int& b) const
+      {
+        if (&a >= begin && &a < end && &b >= begin && &b < end)
+          ++*num_accesses_in_range;
+
+        compare_and_swap<int, std::less<int>>{}(a, b);
+      }
+    };
+
+    template<typename ExecutionPolicy>
+    std::size_t num_comparators_executed_in_place(const ExecutionPolicy policy)
+    {
+      std::array<int, 16> array;
+      std::iota(array.rbegin(), array.rend(), 0);
+
+      std::size_t result = 0;
+      sorting_network<16>{}(policy, array.begin(),
+                            address_recording_compare_and_swap{array.data(), array.data() + array.size(), &result});
+
+      EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+      return result;
+    }
+  }  // namespace
+
+  TEST(execution_policy, all_policies_sort_like_std_sort)
+  {
+    std::default_random_engine rd;
+
+    std::vector<float> values(24);
+    std::generate(values.begin(), values.end(), [&] { return std::uniform_real_distribution<float>{}(rd); });
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    const auto sorted_with = [&](const auto policy) {
+      auto result = values;
+      sorting_network<24>{}(policy, result.begin());
+      return result;
+    };
+
+    EXPECT_EQ(sorted_with(execution::in_place), expected);
+    EXPECT_EQ(sorted_with(execution::registers), expected);
+    EXPECT_EQ(sorted_with(execution::automatic), expected);
+    EXPECT_EQ(sorted_with(execution::compact), expected);
+
+    std::deque<float> deque(values.begin(), values.end());
+    sorting_network<24>{}(execution::registers, deque.begin(), compare_and_swap<float, std::greater<float>>{});
+
+    EXPECT_TRUE(std::equal(deque.begin(), deque.end(), expected.rbegin()));
+  }
+
+  TEST(execution_policy, registers_policy_sorts_a_local_copy)
+  {
+    constexpr std::size_t num_comparators =
+      detail::num_comparators(detail::sorting_network<16, type::bose_nelson_sort>::type{});
+
+    EXPECT_EQ(num_comparators_executed_in_place(execution::in_place), num_comparators);
+    EXPECT_EQ(num_comparators_executed_in_place(execution::registers), 0);
+    EXPECT_EQ(num_comparators_executed_in_place(execution::automatic), 0);
+    EXPECT_EQ(num_comparators_executed_in_place(execution::compact), num_comparators);
+  }
+
+  TEST(execution_policy, compact_policy_stores_the_smallest_index_type)
+  {
+    using network_128 = detail::sorting_network<128, type::batcher_odd_even_merge_sort>::type;
+    using network_512 = detail::sorting_network<512, type::batcher_odd_even_merge_sort>::type;
+
+    using compact_128 = detail::compact_network<128, network_128>;
+    using compact_512 = detail::compact_network<512, network_512>;
+
+    EXPECT_EQ(sizeof(compact_128::comparators[0]), 2);
+    EXPECT_EQ(sizeof(compact_512::comparators[0]), 4);
+    EXPECT_EQ(compact_128::comparators.size(), detail::num_comparators(network_128{}));
+
+    std::vector<std::uint16_t> values(128);
+    std::iota(values.rbegin(), values.rend(), std::uint16_t{0});
+
+    sorting_network<128, type::batcher_odd_even_merge_sort>{}(execution::compact, values.begin());
+
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  }
+
+  TEST(execution_policy, contiguous_iterators_are_detected)
+  {
+    EXPECT_TRUE(detail::is_contiguous_iterator_v<int*>);
+    EXPECT_TRUE(detail::is_contiguous_iterator_v<std::vector<float>::iterator>);
+    EXPECT_FALSE(detail::is_contiguous_iterator_v<std::deque<int>::iterator>);
+    EXPECT_FALSE(detail::is_contiguous_iterator_v<std::vector<bool>::iterator>);
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,103 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/indirect_sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <string>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    struct record
+    {
+      std::int32_t key = 0;
+      std::array<std::int32_t, 31> payload{};
+    };
+
+    template<std::size_t N, type NetworkType>
+    void expect_records_sorted_like_std_sort()
+    {
+      std::default_random_engine rd;
+
+      for (std::size_t i = 0; i < 10; ++i)
+      {
+        std::array<record, N> records;
+
+        for (auto& r : records)
+        {
+          r.key = std::uniform_int_distribution<std::int32_t>{-10, 10}(rd);
+          r.payload.fill(r.key);
+        }
+
+        auto expected = records;
+        std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+
+        indirect_sorting_network<N, NetworkType>{}(records.begin(), &record::key);
+
+        for (std::size_t j = 0; j < N; ++j)
+        {
+          EXPECT_EQ(records[j].key, expected[j].key);
+          EXPECT_THAT(records[j].payload, ::testing::Each(records[j].key));
+        }
+      }
+    }
+  }  // namespace
+
+  TEST(indirect_sorting_network, records_are_ordered_by_key)
+  {
+    expect_records_sorted_like_std_sort<1, type::bose_nelson_sort>();
+    expect_records_sorted_like_std_sort<7, type::bose_nelson_sort>();
+    expect_records_sorted_like_std_sort<16, type::batcher_odd_even_merge_sort>();
+    expect_records_sorted_like_std_sort<27, type::size_optimized_sort>();
+  }
+
+  TEST(indirect_sorting_network, sorted_indices_are_a_permutation)
+  {
+    const std::array<int, 6> values{4, 0, 5, 2, 1, 3};
+
+    const auto indices = indirect_sorting_network<6>::sorted_indices(values.begin(), [](const int v) { return v; });
+
+    EXPECT_THAT(indices, ::testing::ElementsAre(1, 4, 3, 5, 0, 2));
+  }
+
+  TEST(indirect_sorting_network, permutation_is_applied_by_following_cycles)
+  {
+    std::array<std::string, 5> values{"a", "b", "c", "d", "e"};
+    std::array<std::uint8_t, 5> indices{2, 0, 1, 4, 3};
+
+    indirect_sorting_network<5>::apply_permutation(values.begin(), indices);
+
+    EXPECT_THAT(values, ::testing::ElementsAre("c", "a", "b", "e", "d"));
+    EXPECT_THAT(indices, ::testing::ElementsAre(0, 1, 2, 3, 4));
+  }
+
+  TEST(indirect_sorting_network, custom_compare_is_used)
+  {
+    std::array<std::string, 7> values{"ccc", "a", "bbbb", "dd", "eeeeee", "fffff", "ggggggg"};
+
+    indirect_sorting_network<7>{}(
+      values.begin(), [](const std::string& s) { return s.size(); }, std::greater<>{});
+
+    EXPECT_THAT(values, ::testing::ElementsAre("ggggggg", "eeeeee", "fffff", "bbbb", "ccc", "dd", "a"));
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,103 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/insert_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<std::size_t N>
+    void expect_zero_one_inputs_are_ordered()
+    {
+      // by the 0-1 principle it suffices to check all sorted sequences of
+      // zeros and ones followed by a zero or a one
+      for (std::size_t num_zeros = 0; num_zeros < N; ++num_zeros)
+      {
+        for (const int value : {0, 1})
+        {
+          std::array<int, N> array;
+          std::fill(array.begin(), array.end(), 1);
+          std::fill(array.begin(), array.begin() + num_zeros, 0);
+          array.back() = value;
+
+          insert_network<N>{}(array.begin());
+
+          EXPECT_TRUE(std::is_sorted(array.begin(), array.end())) << "N = " << N;
+        }
+      }
+    }
+
+    template<std::size_t... Ns>
+    void expect_zero_one_inputs_are_ordered(std::index_sequence<Ns...>)
+    {
+      (expect_zero_one_inputs_are_ordered<Ns + 1>(), ...);
+    }
+  }  // namespace
+
+  TEST(insert_network, zero_one_inputs_are_ordered)
+  {
+    expect_zero_one_inputs_are_ordered(std::make_index_sequence<70>{});
+  }
+
+  TEST(insert_network, maintains_sorted_buffer)
+  {
+    constexpr std::size_t N = 16;
+
+    std::default_random_engine rd;
+    std::vector<int> values(1000);
+    std::generate(values.begin(), values.end(), [&] { return std::uniform_int_distribution<int>{-1000, 1000}(rd); });
+
+    std::array<int, N> smallest;
+    std::copy_n(values.begin(), N, smallest.begin());
+    std::sort(smallest.begin(), smallest.end());
+
+    std::array<int, N> largest = smallest;
+    std::reverse(largest.begin(), largest.end());
+
+    for (auto it = values.begin() + N; it != values.end(); ++it)
+    {
+      smallest.back() = std::min(smallest.back(), *it);
+      insert_network<N>{}(smallest.begin());
+
+      largest.back() = std::max(largest.back(), *it);
+      insert_network<N>{}(largest.begin(), compare_and_swap<int, std::greater<int>>{});
+    }
+
+    std::sort(values.begin(), values.end());
+
+    EXPECT_TRUE(std::equal(smallest.begin(), smallest.end(), values.begin()));
+    EXPECT_TRUE(std::equal(largest.begin(), largest.end(), values.rbegin()));
+  }
+
+  TEST(insert_network, has_linear_size_and_logarithmic_depth)
+  {
+    using network_t = detail::flattened_network<insert_network<16>::network>;
+
+    EXPECT_EQ(network_t::comparators.size(), 15);
+    EXPECT_EQ(network_t::depth, 7);
+
+    EXPECT_EQ(detail::flattened_network<insert_network<64>::network>::depth, 11);
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,121 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/lexicographic_compare_and_swap.h>
+#include <sorting_network_cpp/sorting_network.h>
+
+#include "test_base.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    struct record
+    {
+      std::int32_t primary = 0;
+      float secondary = 0;
+      std::int32_t payload = 0;
+    };
+
+    template<std::size_t I>
+    struct custom_type_value
+    {
+      constexpr std::int32_t operator()(const custom_type& value) const noexcept { return value.values[I]; }
+    };
+
+    std::array<record, 23> random_records()
+    {
+      std::default_random_engine rd;
+      std::array<record, 23> result;
+
+      // few distinct primary keys, so that the secondary key decides often
+      for (std::size_t i = 0; i < result.size(); ++i)
+        result[i] = record{std::uniform_int_distribution<std::int32_t>{0, 3}(rd),
+                           std::uniform_real_distribution<float>{}(rd), static_cast<std::int32_t>(i)};
+
+      return result;
+    }
+
+    constexpr bool record_less(const record& a, const record& b)
+    {
+      return std::tie(a.primary, a.secondary) < std::tie(b.primary, b.secondary);
+    }
+  }  // namespace
+
+  TEST(lexicographic_compare_and_swap, array_of_structures_is_ordered)
+  {
+    auto records = random_records();
+    auto expected = records;
+    std::sort(expected.begin(), expected.end(), record_less);
+
+    using cas_t = lexicographic_compare_and_swap<record, member_key<&record::primary>, member_key<&record::secondary>>;
+    sorting_network<23>{}(records.begin(), cas_t{});
+
+    for (std::size_t i = 0; i < records.size(); ++i)
+      EXPECT_EQ(records[i].payload, expected[i].payload);
+  }
+
+  TEST(lexicographic_compare_and_swap, structure_of_arrays_is_ordered)
+  {
+    const auto records = random_records();
+    auto expected = records;
+    std::sort(expected.begin(), expected.end(), record_less);
+
+    std::array<std::int32_t, 23> primary;
+    std::array<float, 23> secondary;
+    std::array<std::int32_t, 23> payload;
+
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+      primary[i] = records[i].primary;
+      secondary[i] = records[i].secondary;
+      payload[i] = records[i].payload;
+    }
+
+    sorting_network<23>{}(soa_iterator{primary.begin(), secondary.begin(), payload.begin()},
+                          soa_lexicographic_compare_and_swap<2>{});
+
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+      EXPECT_EQ(primary[i], expected[i].primary);
+      EXPECT_EQ(secondary[i], expected[i].secondary);
+      EXPECT_EQ(payload[i], expected[i].payload);
+    }
+  }
+
+  TEST(lexicographic_compare_and_swap, orders_like_the_comparison_operator_of_custom_type)
+  {
+    std::array<custom_type, 19> values;
+    std::default_random_engine rd;
+
+    std::uniform_int_distribution<std::int32_t> dist{0, 2};
+
+    for (auto& v : values)
+      v.values = {dist(rd), dist(rd)};
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    sorting_network<19>{}(values.begin(),
+                          lexicographic_compare_and_swap<custom_type, custom_type_value<1>, custom_type_value<0>>{});
+
+    EXPECT_EQ(values, expected);
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,98 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    // Value type which counts how often it is copied
+    struct copy_counting_type
+    {
+      static inline std::size_t num_copies = 0;
+
+      int value = 0;
+
+      copy_counting_type() = default;
+      explicit copy_counting_type(const int v) : value(v) {}
+
+      copy_counting_type(const copy_counting_type& other) : value(other.value) { ++num_copies; }
+      copy_counting_type(copy_counting_type&&) = default;
+
+      copy_counting_type& operator=(const copy_counting_type& other)
+      {
+        value = other.value;
+        ++num_copies;
+        return *this;
+      }
+
+      copy_counting_type& operator=(copy_counting_type&&) = default;
+
+      bool operator<(const copy_counting_type& rhs) const { return value < rhs.value; }
+    };
+  }  // namespace
+
+  TEST(move_compare_and_swap, strings_are_ordered)
+  {
+    std::array<std::string, 17> array;
+    std::default_random_engine rd;
+
+    std::generate(array.begin(), array.end(),
+                  [&] { return std::string(32, 'a') + std::to_string(std::uniform_int_distribution<int>{}(rd)); });
+
+    auto expected = array;
+    std::sort(expected.begin(), expected.end());
+
+    sorting_network<17>{}(array.begin());
+
+    EXPECT_EQ(array, expected);
+  }
+
+  TEST(move_compare_and_swap, values_which_are_not_trivially_copyable_are_not_copied)
+  {
+    std::array<copy_counting_type, 16> array;
+
+    for (std::size_t i = 0; i < array.size(); ++i)
+      array[i].value = static_cast<int>((i * 7) % array.size());
+
+    copy_counting_type::num_copies = 0;
+    sorting_network<16, type::batcher_odd_even_merge_sort>{}(array.begin());
+
+    EXPECT_EQ(copy_counting_type::num_copies, 0);
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+  }
+
+  TEST(move_compare_and_swap, ordered_values_are_not_swapped)
+  {
+    std::array<std::string, 3> array{"a", "b", "c"};
+    const auto* const data = array[0].data();
+
+    move_compare_and_swap<std::string, std::less<std::string>>{}(array[0], array[1]);
+    move_compare_and_swap<std::string, std::greater<std::string>>{}(array[1], array[2]);
+
+    EXPECT_THAT(array, ::testing::ElementsAre("a", "c", "b"));
+    EXPECT_EQ(array[0].data(), data);
+  }
+}  // namespace quxflux::sorting_net
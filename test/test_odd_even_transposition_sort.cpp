@@ -0,0 +1,33 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "test_base.h"
+
+#include <sorting_network_cpp/networks/odd_even_transposition_sort.h>
+
+namespace quxflux::sorting_net
+{
+  INSTANTIATE_TYPED_TEST_SUITE_P(sorting_network_test_odd_even_transposition_sort, sorting_network_test,
+                                 test_specs_for_network<type::odd_even_transposition_sort>);
+
+  TEST(odd_even_transposition_sort, has_as_many_comparators_as_bubble_sort_in_n_layers)
+  {
+    using network_t = detail::sorting_network<13, type::odd_even_transposition_sort>::type;
+
+    EXPECT_EQ(detail::num_comparators(network_t{}), 13 * 12 / 2);
+    EXPECT_EQ(detail::flattened_network<network_t>::depth, 13);
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,102 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/padded_sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<std::size_t N, type NetworkType>
+    void expect_sorted_like_std_sort()
+    {
+      if constexpr (padded_available_v<N, NetworkType>)
+      {
+        std::default_random_engine rd;
+
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+          std::array<int, N> array;
+          std::generate(array.begin(), array.end(), [&] { return std::uniform_int_distribution<int>{-100, 100}(rd); });
+
+          auto expected = array;
+          std::sort(expected.begin(), expected.end());
+
+          padded_sorting_network<N, NetworkType>{}(array.begin());
+
+          EXPECT_EQ(array, expected);
+
+          std::sort(expected.begin(), expected.end(), std::greater<int>{});
+          padded_sorting_network<N, NetworkType>{}(array.begin(), compare_and_swap<int, std::greater<int>>{});
+
+          EXPECT_EQ(array, expected);
+        }
+      }
+    }
+
+    template<type NetworkType, std::size_t... Ns>
+    void expect_sorted_like_std_sort(std::index_sequence<Ns...>)
+    {
+      (expect_sorted_like_std_sort<Ns + 1, NetworkType>(), ...);
+    }
+
+    template<std::size_t N, type NetworkType>
+    constexpr std::size_t max_index()
+    {
+      std::size_t result = 0;
+
+      using network = typename padded_sorting_network<N, NetworkType>::network;
+
+      for (const auto [a, b] : detail::flattened_network<network>::comparators)
+        result = std::max({result, a, b});
+
+      return result;
+    }
+  }  // namespace
+
+  TEST(padded_sorting_network, array_is_ordered)
+  {
+    expect_sorted_like_std_sort<type::batcher_odd_even_merge_sort>(std::make_index_sequence<40>{});
+    expect_sorted_like_std_sort<type::size_optimized_sort>(std::make_index_sequence<40>{});
+    expect_sorted_like_std_sort<type::bitonic_merge_sort>(std::make_index_sequence<40>{});
+  }
+
+  TEST(padded_sorting_network, comparators_touching_padding_values_are_removed)
+  {
+    using padded_t = padded_sorting_network<24>;
+    using full_t = detail::sorting_network<32, type::batcher_odd_even_merge_sort>::type;
+
+    EXPECT_LT(detail::num_comparators(padded_t::network{}), detail::num_comparators(full_t{}));
+    EXPECT_EQ((max_index<24, type::batcher_odd_even_merge_sort>()), 23);
+    EXPECT_EQ((max_index<5, type::batcher_odd_even_merge_sort>()), 4);
+  }
+
+  TEST(padded_sorting_network, availability)
+  {
+    EXPECT_TRUE((padded_available_v<24, type::batcher_odd_even_merge_sort>));
+    EXPECT_TRUE((padded_available_v<16, type::bitonic_merge_sort>));
+    EXPECT_FALSE((padded_available_v<5, type::bitonic_merge_sort>));
+    EXPECT_TRUE((padded_available_v<12, type::size_optimized_sort>));
+    EXPECT_FALSE((padded_available_v<20, type::size_optimized_sort>));
+  }
+}  // namespace quxflux::sorting_net
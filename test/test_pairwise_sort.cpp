@@ -0,0 +1,48 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "test_base.h"
+
+#include <sorting_network_cpp/networks/batcher_odd_even_merge_sort.h>
+#include <sorting_network_cpp/networks/pairwise_sort.h>
+
+namespace quxflux::sorting_net
+{
+  INSTANTIATE_TYPED_TEST_SUITE_P(sorting_network_test_pairwise_sort, sorting_network_test,
+                                 test_specs_for_network<type::pairwise_sort>);
+
+  namespace
+  {
+    template<std::size_t N>
+    void expect_same_size_as_batcher_odd_even_merge_sort()
+    {
+      using network_t = typename detail::sorting_network<N, type::pairwise_sort>::type;
+      using batcher_t = typename detail::sorting_network<N, type::batcher_odd_even_merge_sort>::type;
+
+      EXPECT_EQ(detail::num_comparators(network_t{}), detail::num_comparators(batcher_t{}));
+      EXPECT_EQ(detail::flattened_network<network_t>::depth, detail::flattened_network<batcher_t>::depth);
+    }
+  }  // namespace
+
+  TEST(pairwise_sort, has_as_many_comparators_and_layers_as_batcher_odd_even_merge_sort)
+  {
+    expect_same_size_as_batcher_odd_even_merge_sort<2>();
+    expect_same_size_as_batcher_odd_even_merge_sort<8>();
+    expect_same_size_as_batcher_odd_even_merge_sort<16>();
+    expect_same_size_as_batcher_odd_even_merge_sort<32>();
+    expect_same_size_as_batcher_odd_even_merge_sort<64>();
+  }
+}  // namespace quxflux::sorting_net
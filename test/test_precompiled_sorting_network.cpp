@@ -0,0 +1,66 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/precompiled_sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename T, std::size_t N, type NetworkType>
+    void expect_sorted_like_std_sort()
+    {
+      std::default_random_engine rd;
+
+      for (std::size_t i = 0; i < 10; ++i)
+      {
+        std::array<T, N> values;
+        std::generate(values.begin(), values.end(), [&] { return static_cast<T>(rd() % 1000); });
+
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        precompiled_sort<N, NetworkType>(values.data());
+
+        EXPECT_EQ(values, expected);
+      }
+    }
+  }  // namespace
+
+  TEST(precompiled_sorting_network, sorts_like_std_sort)
+  {
+    expect_sorted_like_std_sort<std::int16_t, 2, type::bose_nelson_sort>();
+    expect_sorted_like_std_sort<std::int32_t, 7, type::batcher_odd_even_merge_sort>();
+    expect_sorted_like_std_sort<std::int64_t, 16, type::size_optimized_sort>();
+    expect_sorted_like_std_sort<float, 24, type::bose_nelson_sort>();
+    expect_sorted_like_std_sort<double, 32, type::batcher_odd_even_merge_sort>();
+  }
+
+  TEST(precompiled_sorting_network, availability_matches_the_compiled_combinations)
+  {
+    EXPECT_TRUE((precompiled_available_v<float, 16>));
+    EXPECT_TRUE((precompiled_available_v<std::uint32_t, 24, type::size_optimized_sort>));
+    EXPECT_FALSE((precompiled_available_v<float, 17>));
+    EXPECT_FALSE((precompiled_available_v<std::uint8_t, 16>));
+    EXPECT_FALSE((precompiled_available_v<float, 16, type::bubble_sort>));
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,84 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<std::size_t N, type NetworkType, std::size_t... RunLengths>
+    void expect_sorted_like_std_sort()
+    {
+      std::default_random_engine rd;
+
+      for (std::size_t i = 0; i < 100; ++i)
+      {
+        std::array<int, N> values;
+        std::generate(values.begin(), values.end(), [&] { return std::uniform_int_distribution<int>{0, 9}(rd); });
+
+        auto run_begin = values.begin();
+        for (const std::size_t length : {RunLengths...})
+        {
+          std::sort(run_begin, run_begin + length);
+          run_begin += length;
+        }
+
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        sorting_network<N, NetworkType, presorted_runs<RunLengths...>>{}(values.begin());
+
+        EXPECT_EQ(values, expected);
+      }
+    }
+
+    template<std::size_t N, type NetworkType, typename Presorted>
+    constexpr std::size_t num_pruned_comparators()
+    {
+      using network_t = typename detail::sorting_network<N, NetworkType>::type;
+
+      return detail::num_comparators(typename detail::prune_presorted<N, network_t, Presorted>::type{});
+    }
+  }  // namespace
+
+  TEST(presorted_runs, inputs_adhering_to_the_runs_are_ordered)
+  {
+    expect_sorted_like_std_sort<16, type::bose_nelson_sort, 8, 8>();
+    expect_sorted_like_std_sort<19, type::batcher_odd_even_merge_sort, 10, 9>();
+    expect_sorted_like_std_sort<20, type::size_optimized_sort, 9>();
+    expect_sorted_like_std_sort<12, type::bitonic_merge_sort, 3, 4, 5>();
+  }
+
+  TEST(presorted_runs, merging_two_sorted_halves_leaves_batchers_merge)
+  {
+    // the number of comparators of Batcher's odd-even merge of two sorted halves
+    EXPECT_EQ((num_pruned_comparators<16, type::batcher_odd_even_merge_sort, presorted_runs<8, 8>>()), 25);
+    EXPECT_EQ((num_pruned_comparators<32, type::batcher_odd_even_merge_sort, presorted_runs<16, 16>>()), 65);
+  }
+
+  TEST(presorted_runs, inserting_into_a_sorted_prefix_leaves_insertion)
+  {
+    EXPECT_EQ((num_pruned_comparators<16, type::insertion_sort, presorted_runs<15>>()), 15);
+    EXPECT_EQ((num_pruned_comparators<8, type::insertion_sort, presorted_runs<>>()), 28);
+  }
+}  // namespace quxflux::sorting_net
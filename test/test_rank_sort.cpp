@@ -0,0 +1,63 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "test_base.h"
+
+#include <sorting_network_cpp/networks/rank_sort.h>
+
+#include <algorithm>
+#include <array>
+
+namespace quxflux::sorting_net
+{
+  INSTANTIATE_TYPED_TEST_SUITE_P(sorting_network_test_rank_sort, sorting_network_test,
+                                 test_specs_for_network<type::rank_sort>);
+
+  namespace
+  {
+    struct keyed_value
+    {
+      int key;
+      int value;
+
+      constexpr bool operator==(const keyed_value& rhs) const { return key == rhs.key && value == rhs.value; }
+    };
+
+    struct compare_keys
+    {
+      constexpr bool operator()(const keyed_value& a, const keyed_value& b) const { return a.key < b.key; }
+    };
+  }  // namespace
+
+  TEST(rank_sort, is_available_up_to_16_values)
+  {
+    EXPECT_TRUE((available_v<16, type::rank_sort>));
+    EXPECT_FALSE((available_v<17, type::rank_sort>));
+  }
+
+  TEST(rank_sort, equal_values_keep_their_order)
+  {
+    std::array<keyed_value, 12> values{
+      {{3, 0}, {1, 1}, {3, 2}, {0, 3}, {1, 4}, {3, 5}, {0, 6}, {2, 7}, {1, 8}, {2, 9}, {0, 10}, {3, 11}}};
+
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(), compare_keys{});
+
+    sorting_network<12, type::rank_sort>{}(values.begin(), compare_and_swap<keyed_value, compare_keys>{});
+
+    EXPECT_EQ(values, expected);
+  }
+}  // namespace quxflux::sorting_net
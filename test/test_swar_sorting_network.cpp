@@ -0,0 +1,155 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/swar_sorting_network.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename T, std::size_t N, type NetworkType>
+    void expect_sorted_like_std_sort()
+    {
+      if constexpr (available_v<N, NetworkType>)
+      {
+        std::default_random_engine rd;
+        std::uniform_int_distribution<std::int64_t> values{std::numeric_limits<T>::min(),
+                                                           std::numeric_limits<T>::max()};
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+          std::array<T, N> array;
+
+          // every other input uses only the extreme values to exercise the lane borders
+          if (i % 2 == 0)
+            std::generate(array.begin(), array.end(), [&] { return static_cast<T>(values(rd)); });
+          else
+            std::generate(array.begin(), array.end(), [&] {
+              return values(rd) % 2 == 0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+            });
+
+          auto expected = array;
+          std::sort(expected.begin(), expected.end());
+
+          swar_sorting_network<N, NetworkType>{}(array.begin());
+
+          EXPECT_EQ(array, expected);
+        }
+      }
+    }
+
+    template<typename T, type NetworkType, std::size_t... Ns>
+    void expect_sorted_like_std_sort(std::index_sequence<Ns...>)
+    {
+      (expect_sorted_like_std_sort<T, Ns + 1, NetworkType>(), ...);
+    }
+
+    template<typename T>
+    void expect_all_networks_sort_like_std_sort()
+    {
+      constexpr auto sizes = std::make_index_sequence<8 / sizeof(T)>{};
+
+      expect_sorted_like_std_sort<T, type::insertion_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bubble_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bose_nelson_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::batcher_odd_even_merge_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bitonic_merge_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::size_optimized_sort>(sizes);
+    }
+
+    template<typename T, std::size_t N>
+    void expect_lanes_sorted_like_std_sort()
+    {
+      using unsigned_type = std::make_unsigned_t<T>;
+
+      constexpr std::size_t lane_bits = 8 * sizeof(T);
+      constexpr std::size_t num_lanes = 64 / lane_bits;
+
+      std::default_random_engine rd;
+      std::uniform_int_distribution<std::uint64_t> words;
+
+      for (std::size_t i = 0; i < 100; ++i)
+      {
+        std::array<std::uint64_t, N> array;
+        std::generate(array.begin(), array.end(), [&] { return words(rd); });
+
+        const auto lane = [&](const std::size_t l) {
+          std::array<T, N> result;
+          std::transform(array.begin(), array.end(), result.begin(), [&](const std::uint64_t word) {
+            return static_cast<T>(static_cast<unsigned_type>(word >> (l * lane_bits)));
+          });
+          return result;
+        };
+
+        std::array<std::array<T, N>, num_lanes> expected;
+
+        for (std::size_t l = 0; l < num_lanes; ++l)
+        {
+          expected[l] = lane(l);
+          std::sort(expected[l].begin(), expected[l].end());
+        }
+
+        sorting_network<N>{}(array.begin(), swar_compare_and_swap<T>{});
+
+        for (std::size_t l = 0; l < num_lanes; ++l)
+          EXPECT_EQ(lane(l), expected[l]);
+      }
+    }
+  }  // namespace
+
+  TEST(swar_sorting_network, array_is_ordered_for_8_bit_lanes)
+  {
+    expect_all_networks_sort_like_std_sort<std::uint8_t>();
+    expect_all_networks_sort_like_std_sort<std::int8_t>();
+  }
+
+  TEST(swar_sorting_network, array_is_ordered_for_16_bit_lanes)
+  {
+    expect_all_networks_sort_like_std_sort<std::uint16_t>();
+    expect_all_networks_sort_like_std_sort<std::int16_t>();
+  }
+
+  TEST(swar_sorting_network, array_is_ordered_for_32_bit_lanes)
+  {
+    expect_all_networks_sort_like_std_sort<std::uint32_t>();
+    expect_all_networks_sort_like_std_sort<std::int32_t>();
+  }
+
+  TEST(swar_sorting_network, every_lane_is_ordered_by_swar_compare_and_swap)
+  {
+    expect_lanes_sorted_like_std_sort<std::uint8_t, 12>();
+    expect_lanes_sorted_like_std_sort<std::int8_t, 7>();
+    expect_lanes_sorted_like_std_sort<std::uint16_t, 16>();
+    expect_lanes_sorted_like_std_sort<std::int16_t, 5>();
+    expect_lanes_sorted_like_std_sort<std::int32_t, 33>();
+  }
+
+  TEST(swar_sorting_network, packed_word_is_sorted_at_compile_time)
+  {
+    static_assert(swar_sorting_network<8>::sort_packed<std::uint8_t>(0x0102030405060708) == 0x0807060504030201);
+    static_assert(swar_sorting_network<4>::sort_packed<std::int16_t>(0x0001'ffff'8000'7fff) == 0x7fff'0001'ffff'8000);
+
+    // lanes beyond N are left untouched
+    static_assert(swar_sorting_network<3>::sort_packed<std::uint16_t>(0xabcd'0001'0003'0002) == 0xabcd'0003'0002'0001);
+  }
+}  // namespace quxflux::sorting_net
@@ -0,0 +1,153 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include <sorting_network_cpp/vector_sorting_network.h>
+
+#if defined(SORTING_NETWORK_CPP_HAS_VECTOR_EXTENSIONS)
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace quxflux::sorting_net
+{
+  namespace
+  {
+    template<typename T>
+    T random_value(std::default_random_engine& rd)
+    {
+      if constexpr (std::is_floating_point_v<T>)
+        return std::uniform_real_distribution<T>{-1000, 1000}(rd);
+      else
+        return static_cast<T>(std::uniform_int_distribution<std::int64_t>{-1000, 1000}(rd));
+    }
+
+    template<typename T, std::size_t N, type NetworkType>
+    void expect_sorted_like_std_sort()
+    {
+      if constexpr (available_v<N, NetworkType>)
+      {
+        std::default_random_engine rd;
+
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+          std::array<T, N> array;
+          std::generate(array.begin(), array.end(), [&] { return random_value<T>(rd); });
+
+          auto expected = array;
+          std::sort(expected.begin(), expected.end());
+
+          auto copy = std::vector<T>(array.begin(), array.end());
+
+          vector_sorting_network<N, NetworkType>{}(array.data());
+          vector_sorting_network<N, NetworkType>{}(copy.begin());
+
+          EXPECT_EQ(array, expected);
+          EXPECT_TRUE(std::equal(copy.begin(), copy.end(), expected.begin()));
+        }
+      }
+    }
+
+    template<typename T, type NetworkType, std::size_t... Ns>
+    void expect_sorted_like_std_sort(std::index_sequence<Ns...>)
+    {
+      (expect_sorted_like_std_sort<T, Ns + 1, NetworkType>(), ...);
+    }
+
+    template<typename T>
+    void expect_all_networks_sort_like_std_sort()
+    {
+      constexpr auto sizes = std::make_index_sequence<16>{};
+
+      expect_sorted_like_std_sort<T, type::insertion_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bubble_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bose_nelson_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::batcher_odd_even_merge_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::bitonic_merge_sort>(sizes);
+      expect_sorted_like_std_sort<T, type::size_optimized_sort>(sizes);
+    }
+
+    template<typename T, std::size_t Lanes, std::size_t N>
+    void expect_lanes_sorted_like_std_sort()
+    {
+      std::default_random_engine rd;
+
+      for (std::size_t i = 0; i < 100; ++i)
+      {
+        std::array<vector_t<T, Lanes>, N> array;
+
+        for (auto& v : array)
+          for (std::size_t l = 0; l < Lanes; ++l)
+            v[l] = random_value<T>(rd);
+
+        const auto lane = [&](const std::size_t l) {
+          std::array<T, N> result;
+          std::transform(array.begin(), array.end(), result.begin(), [&](const auto& v) { return v[l]; });
+          return result;
+        };
+
+        std::array<std::array<T, N>, Lanes> expected;
+
+        for (std::size_t l = 0; l < Lanes; ++l)
+        {
+          expected[l] = lane(l);
+          std::sort(expected[l].begin(), expected[l].end());
+        }
+
+        sorting_network<N>{}(array.begin(), vector_compare_and_swap<T, Lanes>{});
+
+        for (std::size_t l = 0; l < Lanes; ++l)
+          EXPECT_EQ(lane(l), expected[l]);
+      }
+    }
+  }  // namespace
+
+  TEST(vector_sorting_network, array_is_ordered_for_integral_types)
+  {
+    expect_all_networks_sort_like_std_sort<std::int16_t>();
+    expect_all_networks_sort_like_std_sort<std::uint32_t>();
+    expect_all_networks_sort_like_std_sort<std::int64_t>();
+  }
+
+  TEST(vector_sorting_network, array_is_ordered_for_floating_point_types)
+  {
+    expect_all_networks_sort_like_std_sort<float>();
+    expect_all_networks_sort_like_std_sort<double>();
+  }
+
+  TEST(vector_sorting_network, lanes_beyond_n_are_left_untouched)
+  {
+    const vector_t<int, 4> v{3, 1, 2, 0};
+    const vector_t<int, 4> sorted = vector_sorting_network<3>::sort_vector<int>(v);
+
+    EXPECT_THAT((std::array<int, 4>{sorted[0], sorted[1], sorted[2], sorted[3]}), ::testing::ElementsAre(1, 2, 3, 0));
+  }
+
+  TEST(vector_sorting_network, every_lane_is_ordered_by_vector_compare_and_swap)
+  {
+    expect_lanes_sorted_like_std_sort<std::uint8_t, 16, 12>();
+    expect_lanes_sorted_like_std_sort<std::int16_t, 8, 7>();
+    expect_lanes_sorted_like_std_sort<std::int32_t, 16, 16>();
+    expect_lanes_sorted_like_std_sort<float, 8, 5>();
+    expect_lanes_sorted_like_std_sort<double, 4, 33>();
+  }
+}  // namespace quxflux::sorting_net
+
+#endif
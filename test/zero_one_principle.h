@@ -0,0 +1,106 @@
+// This file is part of the sorting_network_cpp (https://github.com/quxflux/sorting_network_cpp).
+// Copyright (c) 2022 Lukas Riebel.
+//
+// sorting_network_cpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// sorting_network_cpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <sorting_network_cpp/networks/common.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+namespace quxflux::sorting_net
+{
+  static inline constexpr std::size_t max_array_size_to_verify_exhaustively = 28;
+
+  namespace detail
+  {
+    // Compare and swap operation on 64 inputs of zeros and ones at once: bit k
+    // of the words is the value of input k, the minimum of two bits is their
+    // conjunction, the maximum their disjunction
+    struct zero_one_compare_and_swap
+    {
+      constexpr void operator()(std::uint64_t& a, std::uint64_t& b) const noexcept
+      {
+        const std::uint64_t a_cpy = a;
+        a &= b;
+        b |= a_cpy;
+      }
+    };
+
+    // Returns whether the values at all indices are ordered in each of the 64 inputs
+    template<std::size_t N>
+    constexpr bool is_sorted_zero_one(const std::array<std::uint64_t, N>& words) noexcept
+    {
+      std::uint64_t unordered = 0;
+
+      for (std::size_t i = 0; i + 1 < N; ++i)
+        unordered |= words[i] & ~words[i + 1];
+
+      return unordered == 0;
+    }
+  }  // namespace detail
+
+  // Returns whether the sorting network SortingNetwork (of N values) sorts
+  // every input consisting of zeros and ones, which by the 0-1 principle
+  // implies that it sorts every input. Up to
+  // max_array_size_to_verify_exhaustively values all 2^N inputs are
+  // evaluated, 64 inputs per compare and swap operation; for larger N
+  // num_samples * 64 random inputs of varying density are evaluated.
+  template<std::size_t N, typename SortingNetwork>
+  bool sorts_all_zero_one_inputs(const SortingNetwork& sorting_network, const std::size_t num_samples = 1 << 16)
+  {
+    std::array<std::uint64_t, N> words{};
+
+    if constexpr (N <= max_array_size_to_verify_exhaustively)
+    {
+      // bit k of the word of index i < 6 is bit i of k
+      constexpr std::array<std::uint64_t, 6> low_bits{0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0,
+                                                      0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000};
+
+      // the indices from 6 on are given by the bits of the word index
+      const std::uint64_t num_words = N > 6 ? std::uint64_t{1} << (N - 6) : 1;
+
+      for (std::uint64_t w = 0; w < num_words; ++w)
+      {
+        for (std::size_t i = 0; i < N; ++i)
+          words[i] = i < 6 ? low_bits[i] : ((w >> (i - 6)) & 1 ? ~std::uint64_t{0} : 0);
+
+        sorting_network(words.begin(), detail::zero_one_compare_and_swap{});
+
+        if (!detail::is_sorted_zero_one(words))
+          return false;
+      }
+    } else
+    {
+      std::mt19937_64 rd;
+
+      for (std::size_t s = 0; s < num_samples; ++s)
+      {
+        // the probability of a one is 1/4, 1/2 or 3/4 depending on the sample
+        for (auto& word : words)
+          word = s % 3 == 0 ? rd() & rd() : (s % 3 == 1 ? rd() : rd() | rd());
+
+        sorting_network(words.begin(), detail::zero_one_compare_and_swap{});
+
+        if (!detail::is_sorted_zero_one(words))
+          return false;
+      }
+    }
+
+    return true;
+  }
+}  // namespace quxflux::sorting_net